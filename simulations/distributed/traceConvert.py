@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# @Time    : 18/9/2025 10:00 AM
+# @Author  : Gao Chuanchao
+# @Email   : gaoc0008@e.ntu.edu.sg
+# @File    : traceConvert.py
+#
+# This script packs the per-vehicle trace files <index>.txt (lines of timestamp,x,y)
+# of a map into a single binary file traces.bin, which is memory mapped by
+# MecMobility (see VehicleTraceStore.h for the layout). The coordinates are stored
+# as they are, i.e., the binary file is only used when no geographic coordinate
+# system is configured. It is read only when named by the binaryTraceFile parameter
+# of MecMobility, so rerun this script after changing the text traces.
+
+import os
+import struct
+import sys
+
+MAGIC = b"MECTRC1\0"
+
+
+def read_trace(filename):
+    points = []
+    with open(filename, "r") as f:
+        for line in f:
+            tokens = line.strip().split(",")
+            if len(tokens) < 3:
+                continue
+            timestamp, x, y = float(tokens[0]), float(tokens[1]), float(tokens[2])
+            points.append((x, y, timestamp))
+    return points
+
+
+def find_vehicle_indices(path_folder):
+    indices = []
+    for name in os.listdir(path_folder):
+        stem, ext = os.path.splitext(name)
+        if ext == ".txt" and stem.isdigit():
+            indices.append(int(stem))
+    return sorted(indices)
+
+
+def convert(path_folder, output_filename):
+    # vehicles must be indexed from 0 without gaps, MecMobility looks up the trace by the vehicle index
+    indices = find_vehicle_indices(path_folder)
+    if not indices:
+        raise ValueError(f"no vehicle trace <index>.txt found in {path_folder}")
+    missing = sorted(set(range(indices[-1] + 1)) - set(indices))
+    if missing:
+        raise ValueError(f"vehicle indices in {path_folder} are not contiguous, missing {missing[:10]}"
+                         + (" ..." if len(missing) > 10 else ""))
+
+    traces = []
+    for index in indices:
+        points = read_trace(os.path.join(path_folder, f"{index}.txt"))
+        if not points:
+            raise ValueError(f"the trace of vehicle {index} in {path_folder} is empty")
+        traces.append(points)
+
+    with open(output_filename, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("=II", len(traces), 0))
+
+        first = 0
+        for points in traces:
+            start_time = min(p[2] for p in points)
+            stop_time = max(p[2] for p in points)
+            f.write(struct.pack("=QQdd", first, len(points), start_time, stop_time))
+            first += len(points)
+
+        for points in traces:
+            for p in points:
+                f.write(struct.pack("=ddd", *p))
+
+    return len(traces), first
+
+
+if __name__ == "__main__":
+    map_size = int(sys.argv[1]) if len(sys.argv) > 1 else 4    # 0 is default, 1 is 1km x 1km, ..., 4 is 4km x 4km
+    path_folder = f"./map_{map_size}/path"
+    output_filename = os.path.join(path_folder, "traces.bin")
+    try:
+        vehicles, points = convert(path_folder, output_filename)
+    except (OSError, ValueError) as e:
+        sys.exit(f"traceConvert.py: {e}")
+
+    print("Packed", vehicles, "vehicles and", points, "points to file", output_filename)
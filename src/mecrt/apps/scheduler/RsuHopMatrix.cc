@@ -0,0 +1,194 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    RsuHopMatrix.cc / RsuHopMatrix.h
+//
+//  Description:
+//    This file implements the hop count matrix between RSUs in the backhaul network, limited to maxHops.
+//    RSUs are indexed densely in ascending MacNodeId order. For each source RSU, the set of RSUs within
+//    maxHops (the ball) is kept as a bitset and filled by a BFS that expands the whole frontier word by word.
+//    When a single link changes, only the sources that could reach one of its ends within maxHops are recomputed.
+//    The matrix is owned by the Scheduler and shared by all schemes that forward tasks in the backhaul.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#include "mecrt/apps/scheduler/RsuHopMatrix.h"
+
+#include <set>
+#include <algorithm>
+
+int RsuHopMatrix::update(const map<MacNodeId, map<MacNodeId, double>>& topology, int maxHops)
+{
+    maxHops = min(max(maxHops, 0), (int)UNREACHABLE - 1);
+
+    // the set of RSUs, including the ones only known as neighbors
+    set<MacNodeId> ids;
+    for (const auto& kv : topology) {
+        ids.insert(kv.first);
+        for (const auto& nbr : kv.second)
+            ids.insert(nbr.first);
+    }
+
+    if (maxHops != maxHops_ || (int)ids.size() != numRsus_ || !equal(ids.begin(), ids.end(), rsuIds_.begin())) {
+        maxHops_ = maxHops;
+        rebuild(topology);
+        return numRsus_;
+    }
+
+    // find the links that changed
+    vector<uint64_t> adj(adj_.size(), 0);
+    for (const auto& kv : topology) {
+        int u = rsuIndex_[kv.first];
+        for (const auto& nbr : kv.second) {
+            int v = rsuIndex_[nbr.first];
+            adj[(size_t)u * numWords_ + v / 64] |= (uint64_t)1 << (v % 64);
+        }
+    }
+
+    set<int> endpoints;
+    for (int u = 0; u < numRsus_; u++) {
+        for (int w = 0; w < numWords_; w++) {
+            uint64_t diff = adj[(size_t)u * numWords_ + w] ^ adj_[(size_t)u * numWords_ + w];
+            while (diff) {
+                int v = w * 64 + __builtin_ctzll(diff);
+                diff &= diff - 1;
+                endpoints.insert(u);
+                endpoints.insert(v);
+            }
+        }
+    }
+    if (endpoints.empty())
+        return 0;
+
+    if (endpoints.size() > 2) {     // more than a single link changed
+        adj_.swap(adj);
+        for (int s = 0; s < numRsus_; s++)
+            computeRow(s);
+        return numRsus_;
+    }
+
+    // single link (u, v) in one or both directions: a path from s can only use it if s reaches
+    // u or v in less than maxHops_ hops before the change (the new link can only be entered from these ends)
+    vector<int> affected;
+    for (int s = 0; s < numRsus_; s++) {
+        for (int x : endpoints) {
+            if (hops_[(size_t)s * numRsus_ + x] < maxHops_) {
+                affected.push_back(s);
+                break;
+            }
+        }
+    }
+
+    adj_.swap(adj);
+    for (int s : affected)
+        computeRow(s);
+    return affected.size();
+}
+
+
+void RsuHopMatrix::rebuild(const map<MacNodeId, map<MacNodeId, double>>& topology)
+{
+    set<MacNodeId> ids;
+    for (const auto& kv : topology) {
+        ids.insert(kv.first);
+        for (const auto& nbr : kv.second)
+            ids.insert(nbr.first);
+    }
+
+    rsuIds_.assign(ids.begin(), ids.end());
+    rsuIndex_.clear();
+    numRsus_ = rsuIds_.size();
+    for (int i = 0; i < numRsus_; i++)
+        rsuIndex_[rsuIds_[i]] = i;
+
+    numWords_ = (numRsus_ + 63) / 64;
+    adj_.assign((size_t)numRsus_ * numWords_, 0);
+    ball_.assign((size_t)numRsus_ * numWords_, 0);
+    hops_.assign((size_t)numRsus_ * numRsus_, UNREACHABLE);
+    reachable_.assign(numRsus_, vector<pair<MacNodeId, int>>());
+
+    for (const auto& kv : topology) {
+        int u = rsuIndex_[kv.first];
+        for (const auto& nbr : kv.second) {
+            int v = rsuIndex_[nbr.first];
+            adj_[(size_t)u * numWords_ + v / 64] |= (uint64_t)1 << (v % 64);
+        }
+    }
+
+    for (int s = 0; s < numRsus_; s++)
+        computeRow(s);
+}
+
+
+void RsuHopMatrix::computeRow(int src)
+{
+    uint64_t *ball = &ball_[(size_t)src * numWords_];
+    uint8_t *hops = &hops_[(size_t)src * numRsus_];
+    fill(ball, ball + numWords_, 0);
+    fill(hops, hops + numRsus_, UNREACHABLE);
+
+    vector<uint64_t> frontier(numWords_, 0), next(numWords_);
+    ball[src / 64] |= (uint64_t)1 << (src % 64);
+    frontier[src / 64] |= (uint64_t)1 << (src % 64);
+    hops[src] = 0;
+
+    for (int hop = 1; hop <= maxHops_; hop++) {
+        // next = union of the adjacency rows of the frontier, minus the RSUs already reached
+        fill(next.begin(), next.end(), 0);
+        for (int w = 0; w < numWords_; w++) {
+            uint64_t bits = frontier[w];
+            while (bits) {
+                int u = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                const uint64_t *row = &adj_[(size_t)u * numWords_];
+                for (int k = 0; k < numWords_; k++)
+                    next[k] |= row[k];
+            }
+        }
+
+        bool any = false;
+        for (int w = 0; w < numWords_; w++) {
+            next[w] &= ~ball[w];
+            ball[w] |= next[w];
+            any = any || next[w];
+            uint64_t bits = next[w];
+            while (bits) {
+                hops[w * 64 + __builtin_ctzll(bits)] = hop;
+                bits &= bits - 1;
+            }
+        }
+        if (!any)
+            break;
+        frontier.swap(next);
+    }
+
+    // ascending RSU id, as the indices are
+    vector<pair<MacNodeId, int>>& reachable = reachable_[src];
+    reachable.clear();
+    for (int t = 0; t < numRsus_; t++)
+        if (hops[t] != UNREACHABLE)
+            reachable.emplace_back(rsuIds_[t], hops[t]);
+}
+
+
+int RsuHopMatrix::getHops(MacNodeId src, MacNodeId dst) const
+{
+    auto itSrc = rsuIndex_.find(src);
+    auto itDst = rsuIndex_.find(dst);
+    if (itSrc == rsuIndex_.end() || itDst == rsuIndex_.end())
+        return -1;
+
+    uint8_t hops = hops_[(size_t)itSrc->second * numRsus_ + itDst->second];
+    return (hops == UNREACHABLE) ? -1 : hops;
+}
+
+
+const vector<pair<MacNodeId, int>>& RsuHopMatrix::getReachable(MacNodeId src) const
+{
+    static const vector<pair<MacNodeId, int>> empty;
+    auto it = rsuIndex_.find(src);
+    return (it == rsuIndex_.end()) ? empty : reachable_[it->second];
+}
@@ -0,0 +1,78 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    RsuHopMatrix.cc / RsuHopMatrix.h
+//
+//  Description:
+//    This file implements the hop count matrix between RSUs in the backhaul network, limited to maxHops.
+//    RSUs are indexed densely in ascending MacNodeId order. For each source RSU, the set of RSUs within
+//    maxHops (the ball) is kept as a bitset and filled by a BFS that expands the whole frontier word by word.
+//    When a single link changes, only the sources that could reach one of its ends within maxHops are recomputed.
+//    The matrix is owned by the Scheduler and shared by all schemes that forward tasks in the backhaul.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#ifndef _MECRT_SCHEDULER_RSU_HOP_MATRIX_H_
+#define _MECRT_SCHEDULER_RSU_HOP_MATRIX_H_
+
+#include <map>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include "mecrt/common/MecCommon.h"
+
+using namespace std;
+
+class RsuHopMatrix
+{
+  public:
+    static const uint8_t UNREACHABLE = 0xFF;
+
+  protected:
+    int maxHops_ = 1;   // the maximum number of hops stored in the matrix
+    int numRsus_ = 0;
+    int numWords_ = 0;  // number of 64-bit words per bitset row
+    vector<MacNodeId> rsuIds_;  // index -> RSU id, in ascending order
+    unordered_map<MacNodeId, int> rsuIndex_;  // RSU id -> index
+    vector<uint64_t> adj_;      // adjacency bitsets, row u holds the out-neighbors of u
+    vector<uint64_t> ball_;     // reachability bitsets, row s holds the RSUs within maxHops_ from s
+    vector<uint8_t> hops_;      // hops_[s * numRsus_ + t], UNREACHABLE if beyond maxHops_
+    vector<vector<pair<MacNodeId, int>>> reachable_;    // {dstRsu, hops} within maxHops_ of each source, in ascending RSU id
+
+    /***
+     * Rebuild the index, the adjacency and all rows from the topology
+     */
+    void rebuild(const map<MacNodeId, map<MacNodeId, double>>& topology);
+
+    /***
+     * Recompute the hop counts from one source with a bit-parallel BFS
+     */
+    void computeRow(int src);
+
+  public:
+    RsuHopMatrix() = default;
+
+    /***
+     * Update the matrix to a new backhaul topology {srcRsu: {neighborRsu: cost}}.
+     * Returns the number of source rows recomputed.
+     */
+    int update(const map<MacNodeId, map<MacNodeId, double>>& topology, int maxHops);
+
+    /***
+     * Hop count from src to dst, -1 if dst is not reachable within maxHops
+     */
+    int getHops(MacNodeId src, MacNodeId dst) const;
+
+    /***
+     * The RSUs reachable from src within maxHops (src included with 0 hops), as {rsuId, hops} in ascending RSU id
+     */
+    const vector<pair<MacNodeId, int>>& getReachable(MacNodeId src) const;
+
+    int getNumRsus() const { return numRsus_; }
+};
+
+#endif // _MECRT_SCHEDULER_RSU_HOP_MATRIX_H_
@@ -55,6 +55,7 @@ Scheduler::Scheduler()
     preSchedCheck_ = nullptr;
     postBatchSchedule_ = nullptr;
     distInstGenTimer_ = nullptr;
+    grantAckTimer_ = nullptr;
 
     enableInitDebug_ = false;
 
@@ -102,6 +103,11 @@ Scheduler::~Scheduler()
         cancelAndDelete(distInstGenTimer_);
         distInstGenTimer_ = nullptr;
     }
+    if (grantAckTimer_)
+    {
+        cancelAndDelete(grantAckTimer_);
+        grantAckTimer_ = nullptr;
+    }
 
     if (enableInitDebug_)
         std::cout << "Scheduler::~Scheduler - destroying Scheduler module done!\n";
@@ -120,6 +126,7 @@ void Scheduler::initialize(int stage)
         
         periodicScheduling_ = par("periodicScheduling");
         grantAckInterval_ = par("grantAckInterval");
+        grantBatching_ = par("grantBatching");
 
         faultRecoveryMargin_ = par("faultRecoveryMargin");
         rescheduleAll_ = par("rescheduleAll");
@@ -253,6 +260,8 @@ void Scheduler::initialize(int stage)
         distInstGenTimer_ = new cMessage("DistInstGenTimer");
         distInstGenTimer_->setSchedulingPriority(1);        // after other messages
 
+        grantAckTimer_ = new cMessage("GrantAckTimer");
+
         newAppPending_ = false;
             
         WATCH_SET(pendingScheduleApps_);
@@ -296,6 +305,10 @@ void Scheduler::handleMessage(cMessage *msg)
             EV << NOW << " Scheduler::handleMessage - scheduling completed, time spend: " << schedulingTime_ << endl;
             sendGrant();
         }
+        else if (!strcmp(msg->getName(), "GrantAckTimer"))
+        {
+            checkLostGrant();
+        }
         else if (!strcmp(msg->getName(), "PreScheduleCheck"))   // do necessary service check before next scheduling
         {
             EV << NOW << " Scheduler::handleMessage - pre-scheduling check\n";
@@ -334,12 +347,24 @@ void Scheduler::handleMessage(cMessage *msg)
         delete msg;
         msg = nullptr;
     }
+    else if (!strcmp(msg->getName(), "RsuFDBatch"))  // batched feedback from RSU
+    {
+        recordRsuStatusBatch(msg);
+        delete msg;
+        msg = nullptr;
+    }
     else if (!strcmp(msg->getName(), "SrvFD"))    // service status report from RSU
     {
         updateRsuSrvStatusFeedback(msg);
         delete msg;
         msg = nullptr;
     }
+    else if (!strcmp(msg->getName(), "SrvGrantAck"))    // grant batch acknowledgement from RSU
+    {
+        recordGrantBatchAck(msg);
+        delete msg;
+        msg = nullptr;
+    }
     else if (!strcmp(msg->getName(), "DistToken"))
     {
         if (enableDistScheme_)
@@ -677,6 +702,8 @@ void Scheduler::handlePreSchedulingCheck()
             }
         }
     }
+
+    flushGrantBatches();
 }
 
 
@@ -1015,7 +1042,11 @@ void Scheduler::globalSchedulerReset()
         cancelEvent(preSchedCheck_);
     if (schedComplete_->isScheduled())
         cancelEvent(schedComplete_);
+    if (grantAckTimer_->isScheduled())
+        cancelEvent(grantAckTimer_);
 
+    grantBatchQueue_.clear();
+    pendingGrantBatches_.clear();
     rsuStatus_.clear();
     rsuOnholdRbs_.clear();
     rsuOnholdCus_.clear();
@@ -1109,35 +1140,77 @@ void Scheduler::recordRsuStatus(cMessage *msg)
 {
     Packet* pkt = check_and_cast<Packet*>(msg);
     auto rsuStat = pkt->popAtFront<RsuFeedback>();
-    simtime_t bandUpdateTime = rsuStat->getBandUpdateTime();
-    simtime_t cmpUnitUpdateTime = rsuStat->getCmpUnitUpdateTime();
     MacNodeId gnbId = rsuStat->getGnbId();
 
+    RsuResource report;
+    report.bands = rsuStat->getAvailBands();
+    report.bandCapacity = rsuStat->getTotalBands();
+    report.cmpUnits = rsuStat->getFreeCmpUnits();
+    report.cmpCapacity = rsuStat->getTotalCmpUnits();
+    report.deviceType = rsuStat->getDeviceType();
+    report.resourceType = rsuStat->getResourceType();
+    report.rsuAddress = Ipv4Address(rsuStat->getRsuAddr());
+    report.bandUpdateTime = rsuStat->getBandUpdateTime();
+    report.cmpUpdateTime = rsuStat->getCmpUnitUpdateTime();
+    updateRsuResource(gnbId, report);
+
+    MacNodeId vehId = rsuStat->getVehId();
+    if (vehId == 0) // a status update from node only, no need to update the connection
+    {
+        EV << NOW << " Scheduler::recordRsuStatus - RSU nodeId=" << gnbId 
+            << " status update from node only, no need to update the connection!" << endl;
+        return;
+    }
+
+    updateVehRsuConnection(vehId, gnbId, rsuStat->getBytePerBand(), report.bandUpdateTime);
+}
+
+
+/***
+ * record the RSU status and the connections of all vehicles reported in one batch,
+ * the RSU resource is updated once for the whole batch
+ */
+void Scheduler::recordRsuStatusBatch(cMessage *msg)
+{
+    Packet* pkt = check_and_cast<Packet*>(msg);
+    auto rsuStat = pkt->popAtFront<RsuFeedbackBatch>();
+    MacNodeId gnbId = rsuStat->getGnbId();
+
+    RsuResource report;
+    report.bands = rsuStat->getAvailBands();
+    report.bandCapacity = rsuStat->getTotalBands();
+    report.cmpUnits = rsuStat->getFreeCmpUnits();
+    report.cmpCapacity = rsuStat->getTotalCmpUnits();
+    report.deviceType = rsuStat->getDeviceType();
+    report.resourceType = rsuStat->getResourceType();
+    report.rsuAddress = Ipv4Address(rsuStat->getRsuAddr());
+    report.bandUpdateTime = rsuStat->getBandUpdateTime();
+    report.cmpUpdateTime = rsuStat->getCmpUnitUpdateTime();
+    updateRsuResource(gnbId, report);
+
+    size_t numVehs = rsuStat->getVehIdArraySize();
+    EV << NOW << " Scheduler::recordRsuStatusBatch - RSU nodeId=" << gnbId << " reports " << numVehs << " vehicle connections" << endl;
+
+    for (size_t i = 0; i < numVehs; i++)
+        updateVehRsuConnection(rsuStat->getVehId(i), gnbId, rsuStat->getBytePerBand(i), rsuStat->getRateUpdateTime(i));
+}
+
+
+void Scheduler::updateRsuResource(MacNodeId gnbId, const RsuResource& report)
+{
     // get gnb module by gnbId
     cModule* gnbMod = binder_->getModuleByMacNodeId(gnbId);
     if (gnbMod == nullptr)
-        throw cRuntimeError("Scheduler::recordRsuStatus - cannot find the RSU module by gnbId: %d", gnbId);
+        throw cRuntimeError("Scheduler::updateRsuResource - cannot find the RSU module by gnbId: %d", gnbId);
     // get the gnb index in the gnb vector
     int gnbIndex = gnbMod->getIndex();
 
-    /***
-     * update rsu information
-     */
     if(rsuStatus_.find(gnbId) == rsuStatus_.end())  // first time to record the RSU status
     {
-        RsuResource rsuRes;
-        rsuRes.bands = rsuStat->getAvailBands();
-        rsuRes.bandCapacity = rsuStat->getTotalBands();
-        rsuRes.cmpUnits = rsuStat->getFreeCmpUnits();
-        rsuRes.cmpCapacity = rsuStat->getTotalCmpUnits();
-        rsuRes.deviceType = rsuStat->getDeviceType();
-        rsuRes.resourceType = rsuStat->getResourceType();
-        rsuRes.rsuAddress = Ipv4Address(rsuStat->getRsuAddr());
-        rsuRes.bandUpdateTime = bandUpdateTime;
-        rsuRes.cmpUpdateTime = cmpUnitUpdateTime;
-        rsuStatus_[gnbId] = rsuRes;
-
-        EV << NOW << " Scheduler::recordRsuStatus - RSU[" << gnbIndex << "] nodeId=" << gnbId << " status recorded for the first time, bands: " << rsuRes.bands
+        rsuStatus_[gnbId] = report;
+        const RsuResource& rsuRes = rsuStatus_[gnbId];
+
+        EV << NOW << " Scheduler::updateRsuResource - RSU[" << gnbIndex << "] nodeId=" << gnbId << " status recorded for the first time, bands: " << rsuRes.bands
         << ", cmpUnits: " << rsuRes.cmpUnits << ", deviceType: " << rsuRes.deviceType
         << ", resourceType: " << rsuRes.resourceType << ", rsuAddress: " << rsuRes.rsuAddress << endl;
 
@@ -1149,60 +1222,54 @@ void Scheduler::recordRsuStatus(cMessage *msg)
     else
     {
         RsuResource& rsuRes = rsuStatus_[gnbId];
-        if (bandUpdateTime > rsuRes.bandUpdateTime)
+        if (report.bandUpdateTime > rsuRes.bandUpdateTime)
         {
-            rsuRes.bands = rsuStat->getAvailBands();
-            rsuRes.bandUpdateTime = bandUpdateTime;
+            rsuRes.bands = report.bands;
+            rsuRes.bandUpdateTime = report.bandUpdateTime;
 
-            EV << NOW << " Scheduler::recordRsuStatus - RSU[" << gnbIndex << "] nodeId=" << gnbId << " status updated, bands: " << rsuRes.bands
+            EV << NOW << " Scheduler::updateRsuResource - RSU[" << gnbIndex << "] nodeId=" << gnbId << " status updated, bands: " << rsuRes.bands
                 << ", bandCapacity: " << rsuRes.bandCapacity << ", deviceType: " << rsuRes.deviceType
                 << ", resourceType: " << rsuRes.resourceType << endl;
         }
         else
         {
-            EV << NOW << " Scheduler::recordRsuStatus - RSU[" << gnbIndex << "] nodeId=" << gnbId << " bands information is outdated, ignore!" << endl;
+            EV << NOW << " Scheduler::updateRsuResource - RSU[" << gnbIndex << "] nodeId=" << gnbId << " bands information is outdated, ignore!" << endl;
         }
 
-        if (cmpUnitUpdateTime > rsuRes.cmpUpdateTime)
+        if (report.cmpUpdateTime > rsuRes.cmpUpdateTime)
         {
-            rsuRes.cmpUnits = rsuStat->getFreeCmpUnits();
-            rsuRes.cmpUpdateTime = cmpUnitUpdateTime;
+            rsuRes.cmpUnits = report.cmpUnits;
+            rsuRes.cmpUpdateTime = report.cmpUpdateTime;
 
-            EV << NOW << " Scheduler::recordRsuStatus - RSU[" << gnbIndex << "] nodeId=" << gnbId << " status updated, cmpUnits: " << rsuRes.cmpUnits
+            EV << NOW << " Scheduler::updateRsuResource - RSU[" << gnbIndex << "] nodeId=" << gnbId << " status updated, cmpUnits: " << rsuRes.cmpUnits
                 << ", cmpCapacity: " << rsuRes.cmpCapacity << ", deviceType: " << rsuRes.deviceType
                 << ", resourceType: " << rsuRes.resourceType << endl;
         }
         else
         {
-            EV << NOW << " Scheduler::recordRsuStatus - RSU[" << gnbIndex << "] nodeId=" << gnbId << " cmpUnits information is outdated, ignore!" << endl;
+            EV << NOW << " Scheduler::updateRsuResource - RSU[" << gnbIndex << "] nodeId=" << gnbId << " cmpUnits information is outdated, ignore!" << endl;
         }
     }
+}
 
-    MacNodeId vehId = rsuStat->getVehId();
-    if (vehId == 0) // a status update from node only, no need to update the connection
-    {
-        EV << NOW << " Scheduler::recordRsuStatus - RSU[" << gnbIndex << "] nodeId=" << gnbId 
-            << " status update from node only, no need to update the connection!" << endl;
-        return;
-    }
 
+void Scheduler::updateVehRsuConnection(MacNodeId vehId, MacNodeId gnbId, int bytePerBand, simtime_t updateTime)
+{
     // update the connection between vehicle and rsu
     if (vehAccessRsu_.find(vehId) == vehAccessRsu_.end())
     {
         EV << "\t store the connection between Veh[nodeId=" << vehId << "] and RSU[nodeId=" 
             << gnbId << "] for the first time" << endl;
         vehAccessRsu_[vehId] = {gnbId};
-        veh2RsuRate_[make_tuple(vehId, gnbId)] = rsuStat->getBytePerBand();
-        veh2RsuTime_[make_tuple(vehId, gnbId)] = bandUpdateTime;
     }
     else
     {
         EV << "\t connection between Veh[nodeId=" << vehId << "] and RSU[nodeId=" 
             << gnbId << "] already exists, update the connection information" << endl;
         vehAccessRsu_[vehId].insert(gnbId);
-        veh2RsuRate_[make_tuple(vehId, gnbId)] = rsuStat->getBytePerBand();
-        veh2RsuTime_[make_tuple(vehId, gnbId)] = bandUpdateTime;
     }
+    veh2RsuRate_[make_tuple(vehId, gnbId)] = bytePerBand;
+    veh2RsuTime_[make_tuple(vehId, gnbId)] = updateTime;
         
     EV << "\t Veh[nodeId=" << vehId << "] access to RSU[nodeId=" << gnbId << "] updated, bytePerBand(per TTI): "
         << veh2RsuRate_[make_tuple(vehId, gnbId)] << endl;
@@ -1307,6 +1374,48 @@ void Scheduler::updateRsuSrvStatusFeedback(cMessage *msg)
 
 void Scheduler::checkLostGrant()
 {
+    if (grantBatching_)
+    {
+        simtime_t nextCheck = SIMTIME_MAX;
+        for (auto it = pendingGrantBatches_.begin(); it != pendingGrantBatches_.end(); )
+        {
+            GrantBatch& batch = it->second;
+            if (simTime() - batch.sendTime < grantAckInterval_)
+            {
+                nextCheck = min(nextCheck, batch.sendTime + grantAckInterval_);
+                ++it;
+                continue;
+            }
+
+            // only resend the grants whose decision is still waiting for feedback
+            vector<Ptr<const Grant2Rsu>> grants;
+            for (auto& grant : batch.grants)
+            {
+                AppId appId = grant->getAppId();
+                if ((grant->getStart() && appsWaitInitFb_.find(appId) != appsWaitInitFb_.end()) ||
+                    (grant->getStop() && appsWaitStopFb_.find(appId) != appsWaitStopFb_.end()))
+                    grants.push_back(grant);
+            }
+
+            if (grants.empty())
+            {
+                it = pendingGrantBatches_.erase(it);
+                continue;
+            }
+
+            EV << NOW << " Scheduler::checkLostGrant - acknowledgement lost for grant batch " << it->first 
+                << ", resend " << grants.size() << " grants" << endl;
+            batch.grants.swap(grants);
+            sendGrantBatch(it->first, batch);
+            nextCheck = min(nextCheck, batch.sendTime + grantAckInterval_);
+            ++it;
+        }
+
+        if (nextCheck < SIMTIME_MAX && !grantAckTimer_->isScheduled())
+            scheduleAt(nextCheck, grantAckTimer_);
+        return;
+    }
+
     for(AppId appId : appsWaitInitFb_)
     {
         /**
@@ -1462,15 +1571,31 @@ void Scheduler::sendGrant()
     }
 
     vecSchedule_.clear();
+    flushGrantBatches();
 }
 
 void Scheduler::sendGrantPacket(ServiceInstance& srv, bool isStart, bool isStop)
+{
+    auto grant = createGrant(srv, isStart, isStop);
+
+    if (grantBatching_)
+    {
+        // sent in the batch of the processing RSU by flushGrantBatches()
+        grantBatchQueue_[srv.processGnbId].push_back(grant);
+        return;
+    }
+
+    Packet* pkt = new Packet("SrvGrant");
+    pkt->insertAtBack(grant);
+    sendToProcessingRsu(pkt, srv.processGnbId);
+}
+
+Ptr<Grant2Rsu> Scheduler::createGrant(ServiceInstance& srv, bool isStart, bool isStop)
 {
     MacNodeId processGnbId = srv.processGnbId;
     MacNodeId offloadGnbId = srv.offloadGnbId;
     AppId appId = srv.appId;
     
-    Packet* pkt = new Packet("SrvGrant");
     auto grant = makeShared<Grant2Rsu>();
     grant->setAppId(appId);
     grant->setUeAddr(appInfo_[appId].ueIpv4Address);
@@ -1489,21 +1614,24 @@ void Scheduler::sendGrantPacket(ServiceInstance& srv, bool isStart, bool isStop)
     grant->setExeTime(srv.exeTime);
     grant->setMaxOffloadTime(srv.maxOffloadTime);
     grant->setUtility(srv.utility);
-    
-    pkt->insertAtBack(grant);
 
-    EV << NOW << " Scheduler::sendGrantPacket - send grant packet to RSU[nodeId=" << processGnbId 
+    EV << NOW << " Scheduler::createGrant - grant to RSU[nodeId=" << processGnbId 
         << "], appId: " << appId << ", processGnbId: " << processGnbId << ", offloadGnbId: " << offloadGnbId
         << ", cmpUnits: " << srv.cmpUnits << ", bands: " << srv.bands
         << ", exeTime: " << srv.exeTime << ", maxOffloadTime: " << srv.maxOffloadTime
         << ", resourceType: " << appInfo_[appId].resourceType << ", service: " << srv.serviceType
         << ", utility: " << srv.utility << endl;
 
+    return grant;
+}
+
+void Scheduler::sendToProcessingRsu(Packet *pkt, MacNodeId processGnbId)
+{
     // check if the processing server is the local server
     Ipv4Address processGnbAddr = rsuStatus_[processGnbId].rsuAddress;
     if (processGnbAddr == nodeInfo_->getNodeAddr())  // the processing RSU is the local RSU
     {
-        EV << NOW << " Scheduler::sendGrantPacket - the processing RSU is the local RSU, send to local processing module" << endl;
+        EV << NOW << " Scheduler::sendToProcessingRsu - the processing RSU is the local RSU, send to local processing module" << endl;
         pkt->addTagIfAbsent<SocketInd>()->setSocketId(nodeInfo_->getServerSocketId());
         send(pkt, "socketOut");
         return;
@@ -1511,6 +1639,54 @@ void Scheduler::sendGrantPacket(ServiceInstance& srv, bool isStart, bool isStop)
     socket_.sendTo(pkt, processGnbAddr, MEC_NPC_PORT);
 }
 
+void Scheduler::flushGrantBatches()
+{
+    if (grantBatchQueue_.empty())
+        return;
+
+    for (auto& queued : grantBatchQueue_)
+    {
+        unsigned int batchId = ++grantBatchId_;
+        GrantBatch& batch = pendingGrantBatches_[batchId];
+        batch.processGnbId = queued.first;
+        batch.grants.swap(queued.second);
+        sendGrantBatch(batchId, batch);
+    }
+    grantBatchQueue_.clear();
+
+    if (!grantAckTimer_->isScheduled())
+        scheduleAt(simTime() + grantAckInterval_, grantAckTimer_);
+}
+
+void Scheduler::sendGrantBatch(unsigned int batchId, GrantBatch& batch)
+{
+    EV << NOW << " Scheduler::sendGrantBatch - send grant batch " << batchId << " with " << batch.grants.size() 
+        << " grants to RSU[nodeId=" << batch.processGnbId << "]" << endl;
+
+    Packet* pkt = new Packet("SrvGrantBatch");
+    auto header = makeShared<Grant2RsuBatch>();
+    header->setBatchId(batchId);
+    header->setProcessGnbId(batch.processGnbId);
+    header->setNumGrants((int)batch.grants.size());
+    pkt->insertAtBack(header);
+    for (auto& grant : batch.grants)
+        pkt->insertAtBack(grant);
+
+    batch.sendTime = simTime();
+    sendToProcessingRsu(pkt, batch.processGnbId);
+}
+
+void Scheduler::recordGrantBatchAck(cMessage *msg)
+{
+    auto ack = check_and_cast<Packet*>(msg)->popAtFront<Grant2RsuBatch>();
+    EV << NOW << " Scheduler::recordGrantBatchAck - grant batch " << ack->getBatchId() << " acknowledged by RSU[nodeId=" 
+        << ack->getProcessGnbId() << "]" << endl;
+
+    pendingGrantBatches_.erase(ack->getBatchId());
+    if (pendingGrantBatches_.empty() && grantAckTimer_->isScheduled())
+        cancelEvent(grantAckTimer_);
+}
+
 void Scheduler::stopService(AppId appId)
 {
     EV << NOW << " Scheduler::stopService - stop the service for application " << appId << endl;
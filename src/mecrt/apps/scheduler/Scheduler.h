@@ -29,11 +29,13 @@
 
 #include "mecrt/packets/apps/VecPacket_m.h"
 #include "mecrt/packets/apps/RsuFeedback_m.h"
+#include "mecrt/packets/apps/Grant2Rsu_m.h"
 #include "mecrt/packets/apps/DistToken_m.h"
 #include "mecrt/packets/apps/DistPV_m.h"
 #include "mecrt/common/MecCommon.h"
 #include "mecrt/common/Database.h"
 #include "mecrt/common/NodeInfo.h"
+#include "mecrt/apps/scheduler/RsuHopMatrix.h"
 #include <unordered_map>
 
 
@@ -83,6 +85,13 @@ struct ServiceInstance {
 };
 
 
+struct GrantBatch {
+    MacNodeId processGnbId;     // the processing RSU the batch is sent to
+    vector<inet::Ptr<const Grant2Rsu>> grants;  // the start/stop grants in the batch
+    omnetpp::simtime_t sendTime;    // the time when the batch is (re)sent
+};
+
+
 // service instance represented by (appId, offloading rsuId, processing rsuId, bands, cmpUnits)
 typedef tuple<AppId, MacNodeId, MacNodeId, int, int> srvInstance;
 
@@ -110,6 +119,7 @@ class Scheduler : public omnetpp::cSimpleModule
     double virtualLinkRate_; // the rate of the virtual link in the backhaul network
     double fairFactor_; // the fairness factor for scheduling scheme with forwarding, default is 1.0
     int maxHops_ = 1; // the maximum number of hops for task forwarding in the backhaul network, default is 1
+    RsuHopMatrix rsuHopMatrix_; // hop counts between RSUs within maxHops_, shared by the forwarding schemes
     MacNodeId rsuId_; // the RSU/gNB ID of the scheduler node
 
   protected:
@@ -162,6 +172,11 @@ class Scheduler : public omnetpp::cSimpleModule
     omnetpp::simtime_t schemeExecTime_;    /// the execution time of the scheduling scheme
     omnetpp::simtime_t insGenerateTime_;    /// the time for generating the schedule instances
     omnetpp::simtime_t grantAckInterval_;    /// the interval for sending the grant again
+    bool grantBatching_;    /// whether to send the grants for the same processing RSU in one batch
+    unsigned int grantBatchId_ = 0;    /// the id of the last grant batch
+    map<MacNodeId, vector<inet::Ptr<const Grant2Rsu>>> grantBatchQueue_;  // {processGnbId: grants}, grants not sent yet
+    map<unsigned int, GrantBatch> pendingGrantBatches_;  // {batchId: batch}, batches waiting for acknowledgement
+    omnetpp::cMessage *grantAckTimer_;    /// check the acknowledgement of the grant batches
     double schedulingInterval_;  
 	  double appStopInterval_;    /// the interval for stopping the running application
     double appFeedbackInterval_;    /// the interval for checking the feedback of the running application
@@ -240,6 +255,21 @@ class Scheduler : public omnetpp::cSimpleModule
      */
     virtual void recordRsuStatus(cMessage *msg);
 
+    /***
+     * Record the RSU status and the vehicle connections reported in one batch
+     */
+    virtual void recordRsuStatusBatch(cMessage *msg);
+
+    /***
+     * Update the resource of an RSU if the report is newer than the recorded one
+     */
+    virtual void updateRsuResource(MacNodeId gnbId, const RsuResource& report);
+
+    /***
+     * Update the connection and the data rate between a vehicle and an RSU
+     */
+    virtual void updateVehRsuConnection(MacNodeId vehId, MacNodeId gnbId, int bytePerBand, simtime_t updateTime);
+
     /***
      * Schedule the request
      */
@@ -266,6 +296,31 @@ class Scheduler : public omnetpp::cSimpleModule
      */
     virtual void sendGrantPacket(ServiceInstance& srv, bool isStart, bool isStop);
 
+    /***
+     * Create the grant chunk of a service instance
+     */
+    virtual inet::Ptr<Grant2Rsu> createGrant(ServiceInstance& srv, bool isStart, bool isStop);
+
+    /***
+     * Send a grant packet to the processing RSU, either the local server or the NPC of a remote RSU
+     */
+    virtual void sendToProcessingRsu(inet::Packet *pkt, MacNodeId processGnbId);
+
+    /***
+     * Send the queued grants, one batch per processing RSU
+     */
+    virtual void flushGrantBatches();
+
+    /***
+     * Send (or resend) a pending grant batch
+     */
+    virtual void sendGrantBatch(unsigned int batchId, GrantBatch& batch);
+
+    /***
+     * Remove the acknowledged grant batch from the pending list
+     */
+    virtual void recordGrantBatchAck(cMessage *msg);
+
     /**
      * stop the running/in-initializing service
      */
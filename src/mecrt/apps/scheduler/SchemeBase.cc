@@ -30,7 +30,8 @@ SchemeBase::SchemeBase(Scheduler *scheduler)
       rbStep_(scheduler->rbStep_),
       resourceSlack_(scheduler->resourceSlack_),
       srvTimeScale_(scheduler->srvTimeScale_),
-      maxHops_(scheduler->maxHops_)
+      maxHops_(scheduler->maxHops_),
+      hopMatrix_(scheduler->rsuHopMatrix_)
 {
     EV << NOW << " SchemeBase::SchemeBase - Initialized" << endl;
 }
@@ -40,64 +41,12 @@ void SchemeBase::updateReachableRsus(const map<MacNodeId, map<MacNodeId, double>
 {
     /***
      * store the RSU hop reachability, i.e., which RSUs can be reached from which RSU with maxHops_ hops
-     * {
-     *   {rsuId1, {rsuId2: hopCount, rsuId3: hopCount, ...}},
-     *   {rsuId4, {rsuId5: hopCount, rsuId6: hopCount, ...}},
-     *   ...
-     * }
-     * using BFS to find the reachable RSUs and their hop counts, store the result in reachableRsus_
+     * the hop matrix is shared by the scheduler and only recomputes the affected rows on a single link change
      */
-    EV << NOW << " SchemeBase::updateReachableRsus - update reachable RSUs with maxHops=" << maxHops_ << endl;
-
-    reachableRsus_.clear();
-    for (const auto& kv: topology)   // enumerate the topology
-    {
-        MacNodeId src = kv.first;
-        queue<MacNodeId> q;
-        map<MacNodeId, int> visited; // map to store the hop count for each RSU
-        q.push(src);
-        visited[src] = 0; // src is reachable from itself with 0 hops
-        vector<MacNodeId> sortedRsus; // vector to store the reachable RSUs sorted by hop counts
-        sortedRsus.push_back(src);
-        while (!q.empty())
-        {
-            MacNodeId currentRsu = q.front();
-            q.pop();
-            int currentHopCount = visited[currentRsu];
-            // if the current hop count exceeds the maximum hops, stop the search
-            if (currentHopCount >= maxHops_)
-                continue;
-            // iterate through the neighbors of the current RSU
-            for (const auto& neighborKv : topology.at(currentRsu))
-            {
-                int neighbor = neighborKv.first;
-                // if the neighbor is not visited, add it to the queue and mark it as visited
-                if (visited.find(neighbor) == visited.end())
-                {
-                    visited[neighbor] = currentHopCount + 1; // increment the hop count
-                    sortedRsus.push_back(neighbor);
-                    q.push(neighbor);
-                }
-            }
-        }
-        // Store the hop reachability information for the current RSU
-        reachableRsus_[src] = visited;
-        sortedReachableRsus_[src] = sortedRsus;
-    }
-
-    // print the reachable RSUs for each RSU
-    for (const auto& kv : reachableRsus_)
-    {
-        MacNodeId rsuId = kv.first;
-        EV << "\tRSU[nodeId=" << rsuId << "] can reach:";
-        for (const auto& neighborKv : kv.second)
-        {
-            MacNodeId neighborId = neighborKv.first;
-            int hopCount = neighborKv.second;
-            EV << " nodeId=" << neighborId << " (hop=" << hopCount << "),";
-        }
-        EV << endl;
-    }
+    int updatedRows = hopMatrix_.update(topology, maxHops_);
+
+    EV << NOW << " SchemeBase::updateReachableRsus - update reachable RSUs with maxHops=" << maxHops_
+       << ", " << updatedRows << " of " << hopMatrix_.getNumRsus() << " RSUs recomputed" << endl;
 }
 
 
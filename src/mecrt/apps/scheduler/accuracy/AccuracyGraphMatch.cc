@@ -113,7 +113,7 @@ void AccuracyGraphMatch::generateScheduleInstances()
                 
                 int maxRB = floor(rsuRBs_[offRsuIndex] * fairFactor_);  // maximum resource blocks for the offload RSU
                 // find the accessible RSU from the offload RSU, {procRsuId: hopCount}, the accessible processing RSUs from the offload RSU
-                map<MacNodeId, int> accessibleProRsus = reachableRsus_[offRsuId];
+                const vector<pair<MacNodeId, int>>& accessibleProRsus = hopMatrix_.getReachable(offRsuId);
                 for (auto& pair : accessibleProRsus)
                 {
                     if (rsuStatus_.find(pair.first) == rsuStatus_.end())
@@ -824,7 +824,7 @@ vector<srvInstance> AccuracyGraphMatch::fractionalLocalRatioMethod(TripartiteGra
             continue;
         MacNodeId srcId = rsuIds_[offRsuIdx];
         MacNodeId dstId = rsuIds_[proRsuIdx];
-        int hopCount = reachableRsus_[srcId][dstId];
+        int hopCount = hopMatrix_.getHops(srcId, dstId);
         double fwdDelay = computeForwardingDelay(hopCount, appInfo_[appId].inputSize);
         double maxOffloadDelay = appInfo_[appId].period.dbl() - processDelay - fwdDelay - offloadOverhead_;
 
@@ -112,7 +112,7 @@ void AccuracyGreedy::generateScheduleInstances()
 
                 int maxRB = floor(rsuRBs_[offRsuIndex] * fairFactor_);  // maximum resource blocks for the offload RSU
                 // find the accessible RSU from the offload RSU, {procRsuId: hopCount}, the accessible processing RSUs from the offload RSU
-                map<MacNodeId, int> accessibleProRsus = reachableRsus_[offRsuId];
+                const vector<pair<MacNodeId, int>>& accessibleProRsus = hopMatrix_.getReachable(offRsuId);
                 for (auto& pair : accessibleProRsus)
                 {
                     // check if the processing RSU is available
@@ -104,7 +104,7 @@ void SchemeFwdGraphMatch::generateScheduleInstances()
                     continue;  // if not found, skip
                 
                 // find the accessible RSU from the offload RSU
-                map<MacNodeId, int> accessibleProRsus = reachableRsus_[offRsuId]; // {procRsuId: hopCount}
+                const vector<pair<MacNodeId, int>>& accessibleProRsus = hopMatrix_.getReachable(offRsuId); // {procRsuId: hopCount}
                 int offRsuIndex = rsuId2Index_[offRsuId];  // get the index of the RSU in the rsuIds vector
                 int maxRB = floor(rsuRBs_[offRsuIndex] * fairFactor_);  // maximum resource blocks for the offload RSU
                 for (int resBlocks = maxRB; resBlocks > 0; resBlocks -= rbStep_)   // enumerate the resource blocks, counting down
@@ -762,7 +762,7 @@ vector<srvInstance> SchemeFwdGraphMatch::fractionalLocalRatioMethod(TripartiteGr
         double processDelay = computeExeDelay(appId, rsuIds_[proRsuIdx], cuDemand);
         MacNodeId srcId = rsuIds_[offRsuIdx];
         MacNodeId dstId = rsuIds_[proRsuIdx];
-        int hopCount = reachableRsus_[srcId][dstId];
+        int hopCount = hopMatrix_.getHops(srcId, dstId);
         double fwdDelay = computeForwardingDelay(hopCount, appInfo_[appId].inputSize);
         double maxOffloadDelay = appInfo_[appId].period.dbl() - processDelay - fwdDelay - offloadOverhead_;
 
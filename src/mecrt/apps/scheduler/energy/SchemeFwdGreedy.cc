@@ -99,7 +99,7 @@ void SchemeFwdGreedy::generateScheduleInstances()
                     continue;  // if not found, skip
 
                 // find the accessible RSU from the offload RSU
-                map<MacNodeId, int> accessibleProRsus = reachableRsus_[offRsuId]; // {procRsuId: hopCount}, the accessible processing RSUs from the offload RSU
+                const vector<pair<MacNodeId, int>>& accessibleProRsus = hopMatrix_.getReachable(offRsuId); // {procRsuId: hopCount}, the accessible processing RSUs from the offload RSU
                 int offRsuIndex = rsuId2Index_[offRsuId];  // get the index of the RSU in the rsuIds vector
                 int maxRB = floor(rsuRBs_[offRsuIndex] * fairFactor_);  // maximum resource blocks for the offload RSU
                 for (int resBlocks = maxRB; resBlocks > 0; resBlocks -= rbStep_)   // enumerate the resource blocks, counting down
@@ -189,25 +189,33 @@ void Server::handleMessage(cMessage *msg)
             msg = nullptr;
             return;
         }
-        else if(!strcmp(msg->getName(), "SrvGrant")){
-            auto pkt = check_and_cast<Packet *>(msg);
-            auto pktGrant = pkt->popAtFront<Grant2Rsu>();
-            AppId appId = pktGrant->getAppId();
-
-            if (pktGrant->getStart() && (grantedService_.find(appId) == grantedService_.end()))
-            {
-                if (nodeInfo_->getGlobalSchedulerAddr() != Ipv4Address::UNSPECIFIED_ADDRESS)
-                    initializeService(pktGrant);
-            }
-            else if (pktGrant->getStop() && (grantedService_.find(appId) != grantedService_.end()))
+        else if(!strcmp(msg->getName(), "RsuFDBatch")){
+            if (!nodeInfo_->getGlobalSchedulerAddr().isUnspecified())
             {
-                stopService(appId);
+                auto pkt = check_and_cast<Packet *>(msg);
+                handleRsuFeedbackBatch(pkt);
             }
+
+            delete msg;
+            msg = nullptr;
+            return;
+        }
+        else if(!strcmp(msg->getName(), "SrvGrant")){
+            auto pkt = check_and_cast<Packet *>(msg);
+            handleServiceGrant(pkt->popAtFront<Grant2Rsu>());
             
             delete msg;
             msg = nullptr;
             return;
         }
+        else if(!strcmp(msg->getName(), "SrvGrantBatch")){
+            auto pkt = check_and_cast<Packet *>(msg);
+            handleServiceGrantBatch(pkt);
+
+            delete msg;
+            msg = nullptr;
+            return;
+        }
         else if(!strcmp(msg->getName(), "SrvFD")){
             if (nodeInfo_->getGlobalSchedulerAddr() == Ipv4Address::UNSPECIFIED_ADDRESS)
             {
@@ -338,15 +346,38 @@ void Server::handleRsuFeedback(inet::Packet *pkt)
 
     Packet* packet = new Packet("RsuFD");
     packet->insertAtFront(rsuFdCopy);
+    sendRsuFeedback(packet);
+}
+
+void Server::handleRsuFeedbackBatch(inet::Packet *pkt)
+{
+    auto rsuFdBatch = pkt->peekAtFront<RsuFeedbackBatch>();
+    EV << "Server::handleRsuFeedbackBatch - update RSU status feedback of " << rsuFdBatch->getVehIdArraySize() 
+        << " vehicles and send it to the scheduler " << endl;
+
+    auto rsuFdBatchCopy = makeShared<RsuFeedbackBatch>(*rsuFdBatch);
+    rsuFdBatchCopy->setFreeCmpUnits(cmpUnitFree_);
+    rsuFdBatchCopy->setDeviceType(deviceType_.c_str());
+    rsuFdBatchCopy->setResourceType(resourceType_.c_str());
+    rsuFdBatchCopy->setTotalCmpUnits(cmpUnitTotal_);
+    rsuFdBatchCopy->setCmpUnitUpdateTime(simTime());
+
+    Packet* packet = new Packet("RsuFDBatch");
+    packet->insertAtFront(rsuFdBatchCopy);
+    sendRsuFeedback(packet);
+}
+
+void Server::sendRsuFeedback(inet::Packet *packet)
+{
     if (nodeInfo_->getIsGlobalScheduler())
     {
-        EV << "Server::handleRsuFeedback - local scheduler is global scheduler, send feedback to local scheduler." << endl;
+        EV << "Server::sendRsuFeedback - local scheduler is global scheduler, send feedback to local scheduler." << endl;
         packet->addTagIfAbsent<SocketInd>()->setSocketId(nodeInfo_->getLocalSchedulerSocketId());
         send(packet, "socketOut");
     }
     else 
     {
-        EV << "Server::handleRsuFeedback - local scheduler is not global scheduler, send feedback to global scheduler " 
+        EV << "Server::sendRsuFeedback - local scheduler is not global scheduler, send feedback to global scheduler " 
         << nodeInfo_->getGlobalSchedulerAddr() << endl;
         socket.sendTo(packet, nodeInfo_->getGlobalSchedulerAddr(), MEC_NPC_PORT);
     }
@@ -451,6 +482,41 @@ void Server::sendGrant2OffloadingNic(AppId appId, bool isStop)
 }
 
 
+void Server::handleServiceGrant(inet::Ptr<const Grant2Rsu> pktGrant)
+{
+    AppId appId = pktGrant->getAppId();
+
+    if (pktGrant->getStart() && (grantedService_.find(appId) == grantedService_.end()))
+    {
+        if (nodeInfo_->getGlobalSchedulerAddr() != Ipv4Address::UNSPECIFIED_ADDRESS)
+            initializeService(pktGrant);
+    }
+    else if (pktGrant->getStop() && (grantedService_.find(appId) != grantedService_.end()))
+    {
+        stopService(appId);
+    }
+}
+
+
+void Server::handleServiceGrantBatch(inet::Packet *pkt)
+{
+    auto batch = pkt->popAtFront<Grant2RsuBatch>();
+    EV << "Server::handleServiceGrantBatch - received grant batch " << batch->getBatchId() 
+        << " with " << batch->getNumGrants() << " grants" << endl;
+
+    for (int i = 0; i < batch->getNumGrants() && pkt->getDataLength() > b(0); i++)
+        handleServiceGrant(pkt->popAtFront<Grant2Rsu>());
+
+    if (nodeInfo_->getGlobalSchedulerAddr() == Ipv4Address::UNSPECIFIED_ADDRESS)
+        return;
+
+    // acknowledge the whole batch, the result of each grant is reported by SrvFD as before
+    Packet* packet = new Packet("SrvGrantAck");
+    packet->insertAtFront(makeShared<Grant2RsuBatch>(*batch));
+    socket.sendTo(packet, nodeInfo_->getGlobalSchedulerAddr(), MEC_NPC_PORT);
+}
+
+
 void Server::initializeService(inet::Ptr<const Grant2Rsu> pkt)
 {
     AppId appId = pkt->getAppId();
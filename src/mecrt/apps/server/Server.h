@@ -138,10 +138,18 @@ class Server : public omnetpp::cSimpleModule
 
     virtual void handleRsuFeedback(inet::Packet *pkt);
 
+    virtual void handleRsuFeedbackBatch(inet::Packet *pkt);
+
+    virtual void sendRsuFeedback(inet::Packet *packet);
+
     virtual void handleServiceFeedback(omnetpp::cMessage *msg);
 
     virtual void sendGrant2OffloadingNic(AppId appId, bool isStop);
 
+    virtual void handleServiceGrant(inet::Ptr<const Grant2Rsu> pktGrant);
+
+    virtual void handleServiceGrantBatch(inet::Packet *pkt);
+
     virtual void initializeService(inet::Ptr<const Grant2Rsu> pkt);
 
     virtual void stopService(AppId appId);
@@ -55,8 +55,11 @@ void BandManager::initialize(int stage)
         frequency_ = par("carrierFrequency");
         int numerology = par("numerologyIndex");
         ttiPeriod_ = getBinder()->getSlotDurationFromNumerologyIndex(numerology);
-        transmitMapUl_.clear();
+        activeRbMapUl_.clear();
+        ulEndTime_.clear();
         uePhy_.clear();
+        lastUpdateTime_ = -1;
+        idleTicks_ = 0;
 
         // offloadEnergyConsumedSignal_ = registerSignal("offloadEnergyConsumed");
         // offloadConsumedEnergy_ = 0.0;
@@ -84,7 +87,7 @@ void BandManager::initialize(int stage)
          */
         updateTick_ = new omnetpp::cMessage("updateTick");
         updateTick_->setSchedulingPriority(2);  // after the flushAppMsg in UeMac
-        scheduleAt(simTime() + ttiPeriod_, updateTick_);
+        // the tick is started by the first uplink transmission, see scheduleUpdateTick()
 
         if (enableInitDebug_)
             std::cout << "BandManager::initialize - stage: INITSTAGE_LAST - ends" << std::endl;
@@ -101,6 +104,8 @@ void BandManager::handleMessage(omnetpp::cMessage *msg)
     {
         if (!strcmp(msg->getName(), "updateTick"))
         {
+            lastUpdateTime_ = NOW;
+
             // ===== reach the end of the TTI (any data generated at this TTI has reached the physical stack) =====
             // init and reset global allocation information
             binder_->initAndResetUlTransmissionInfo();
@@ -108,16 +113,62 @@ void BandManager::handleMessage(omnetpp::cMessage *msg)
             // update the uplink band allocation for the UE
             updateTransmissionUl();
 
-            scheduleAt(simTime() + ttiPeriod_, updateTick_);
+            /***
+             * the binder keeps the allocation of the current and the previous TTI, so the tick keeps
+             * running for two idle TTIs to clear both, then stops until the next transmission arrives
+             */
+            idleTicks_ = activeRbMapUl_.empty() ? idleTicks_ + 1 : 0;
+            if (idleTicks_ < 2)
+                scheduleAt(simTime() + ttiPeriod_, updateTick_);
+            else
+                EV << "BandManager::handleMessage - no active uplink transmission, stop the update tick" << endl;
         }
     }
 }
 
+void BandManager::scheduleUpdateTick()
+{
+    idleTicks_ = 0;
+    if (updateTick_ == nullptr || updateTick_->isScheduled())
+        return;
+
+    // align to the TTI grid, the update at the current TTI boundary may have been done already
+    int64_t periodRaw = SimTime(ttiPeriod_).raw();
+    int64_t nextRaw = ((NOW.raw() + periodRaw - 1) / periodRaw) * periodRaw;
+    SimTime nextTick;
+    nextTick.setRaw(nextRaw);
+    if (nextTick <= lastUpdateTime_)
+        nextTick = lastUpdateTime_ + ttiPeriod_;
+
+    scheduleAt(nextTick, updateTick_);
+}
+
+void BandManager::removeUePhy(MacNodeId ueId)
+{
+    EV << "BandManager::removeUePhy - UE [" << ueId << "] removed" << endl;
+
+    uePhy_.erase(ueId);
+    offloadPower_.erase(ueId);
+
+    // the heap entries of the removed links become stale and are skipped on expiry
+    for (auto it = activeRbMapUl_.begin(); it != activeRbMapUl_.end(); )
+    {
+        if (it->first.first == ueId)
+        {
+            ulEndTime_.erase(it->first);
+            it = activeRbMapUl_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
 void BandManager::addTransmissionUl(MacNodeId ueId, MacNodeId destId, RbMap& rbMap, simtime_t endTime)
 {
     EV << "BandManager::addTransmissionUl - UE [" << ueId << "] - add transmission to destination [" << destId 
         << "]" << " end time " << endTime.dbl() << endl;
 
+    UlLink link(ueId, destId);
     // for each allocated band, store the UE info
     std::map<Band, unsigned int>::iterator it = rbMap[antenna_].begin(), et = rbMap[antenna_].end();
     for ( ; it != et; ++it)
@@ -125,70 +176,70 @@ void BandManager::addTransmissionUl(MacNodeId ueId, MacNodeId destId, RbMap& rbM
         Band b = it->first;
         if (it->second > 0)
         {
-            // check if the band exist in band map
-            if (transmitMapUl_[ueId][destId].find(b) == transmitMapUl_[ueId][destId].end())
+            // check if the band exist in band map, an ongoing transmission is only extended
+            auto endIt = ulEndTime_[link].find(b);
+            if (endIt == ulEndTime_[link].end())
             {
-                transmitMapUl_[ueId][destId][b] = endTime;
+                ulEndTime_[link][b] = endTime;
+                activeRbMapUl_[link][antenna_][b] = 1;
+                ulEndHeap_.push({endTime, ueId, destId, b});
             }
-            else
+            else if (endIt->second < endTime)
             {
-                if (transmitMapUl_[ueId][destId][b] < endTime)
-                    transmitMapUl_[ueId][destId][b] = endTime;
+                endIt->second = endTime;
+                ulEndHeap_.push({endTime, ueId, destId, b});  // the old heap entry becomes stale
             }
         }
     }
+
+    scheduleUpdateTick();
 }
 
-void BandManager::updateTransmissionUl()
+void BandManager::expireTransmissionUl()
 {
-    // update the uplink band allocation for the UE, {ueId: {destId: {band: endTime}}}
-    set<MacNodeId> activeUes;  // set to store the active UEs
-    for (auto ueIt = transmitMapUl_.begin(); ueIt != transmitMapUl_.end();)
+    // pop the ended transmissions, i.e., endTime <= NOW
+    while (!ulEndHeap_.empty() && ulEndHeap_.top().endTime <= NOW)
     {
-        for (auto destIt = ueIt->second.begin(); destIt != ueIt->second.end();)
+        UlBandEnd end = ulEndHeap_.top();
+        ulEndHeap_.pop();
+
+        UlLink link(end.ueId, end.destId);
+        auto linkIt = ulEndTime_.find(link);
+        if (linkIt == ulEndTime_.end())
+            continue;
+        auto endIt = linkIt->second.find(end.band);
+        if (endIt == linkIt->second.end() || endIt->second != end.endTime)
+            continue;   // stale entry, the transmission on this band has been extended
+
+        linkIt->second.erase(endIt);
+        RbMap& rbMap = activeRbMapUl_[link];
+        rbMap[antenna_].erase(end.band);
+        if (linkIt->second.empty())
         {
-            RbMap rbMap;
-            bool hasData = false;
-            for (auto bandIt = destIt->second.begin(); bandIt != destIt->second.end();)
-            {
-                if (NOW < bandIt->second)   // the transmission is ongoing
-                {
-                    rbMap[antenna_][bandIt->first] = 1;
-                    hasData = true;
-                    ++bandIt;   // move to the next band
-                    activeUes.insert(ueIt->first);  // add the UE to the active UEs set
-                }
-                else
-                {
-                    bandIt = destIt->second.erase(bandIt);  // remove the band from the map and move to the next band
-                }
-            }
-
-            if (hasData)
-            {
-                MacNodeId ueId = ueIt->first;
-                binder_->storeUlTransmissionMap(frequency_, antenna_, rbMap, ueId, destIt->first, uePhy_[ueId], dir_);
-                ++destIt;   // move to the next destination
-            }
-            else
-            {
-                destIt = ueIt->second.erase(destIt);    // remove the destination from the map and move to the next destination
-            }
+            ulEndTime_.erase(linkIt);
+            activeRbMapUl_.erase(link);
         }
+    }
+}
 
-        if (!ueIt->second.empty())
-            ++ueIt;    // move to the next UE
-        else
-            ueIt = transmitMapUl_.erase(ueIt);    // remove the UE from the map and move to the next UE
+void BandManager::updateTransmissionUl()
+{
+    // remove the bands whose transmission has ended
+    expireTransmissionUl();
+
+    // the binder resets the allocation every TTI, store the ongoing transmissions, {(ueId, destId): rbMap}
+    for (auto& entry : activeRbMapUl_)
+    {
+        MacNodeId ueId = entry.first.first;
+        binder_->storeUlTransmissionMap(frequency_, antenna_, entry.second, ueId, entry.first.second, uePhy_[ueId], dir_);
     }
 
     // update the offload energy consumed signal
     // offloadConsumedEnergy_ = 0;
-    // for (MacNodeId ueId : activeUes)
+    // for (auto& entry : activeRbMapUl_)
     // {
-    //     offloadConsumedEnergy_ += offloadPower_[ueId] * ttiPeriod_;
+    //     offloadConsumedEnergy_ += offloadPower_[entry.first.first] * ttiPeriod_;
     // }
 
     // emit(offloadEnergyConsumedSignal_, offloadConsumedEnergy_);
 }
-
@@ -19,6 +19,7 @@
 #define _VEC_BANDMANAGER_H_
 
 #include <string.h>
+#include <queue>
 #include <omnetpp.h>
 #include <inet/common/INETDefs.h>
 #include "common/LteCommon.h"
@@ -43,9 +44,30 @@ class BandManager : public omnetpp::cSimpleModule
 	double frequency_;
 
 	omnetpp::cMessage* updateTick_;
-
-	// {ueId: {destId: {band: endTime}}}, the map of the transmission parameters
-	map<MacNodeId, map<MacNodeId, map<Band, simtime_t>>> transmitMapUl_;
+	simtime_t lastUpdateTime_;	// the time of the last executed update tick
+	int idleTicks_;	// number of consecutive update ticks without active transmission
+
+	/***
+	 * interval registry of the uplink transmissions.
+	 * each band used by a (ue, dest) pair is active in [start, end), its end time is kept in
+	 * ulEndTime_ and pushed into the end-time heap ulEndHeap_. the RbMap of each (ue, dest) pair
+	 * is only changed when a transmission starts (addTransmissionUl) or ends (heap pop), and
+	 * the per-TTI update replays activeRbMapUl_ to the binder.
+	 */
+	struct UlBandEnd
+	{
+		simtime_t endTime;
+		MacNodeId ueId;
+		MacNodeId destId;
+		Band band;
+
+		bool operator>(const UlBandEnd& other) const { return endTime > other.endTime; }
+	};
+	typedef pair<MacNodeId, MacNodeId> UlLink;	// (ueId, destId)
+
+	map<UlLink, RbMap> activeRbMapUl_;	// {(ueId, destId): rbMap}, bands currently in use
+	map<UlLink, map<Band, simtime_t>> ulEndTime_;	// {(ueId, destId): {band: endTime}}
+	priority_queue<UlBandEnd, vector<UlBandEnd>, greater<UlBandEnd>> ulEndHeap_;	// min-heap on end time, may hold stale entries
 	
 	map<MacNodeId, UePhy*> uePhy_;
 	map<MacNodeId, double> offloadPower_;
@@ -69,9 +91,19 @@ class BandManager : public omnetpp::cSimpleModule
 		offloadPower_[ueId] = power;
 	}
 
+	// the UE left the simulation, drop its PHY and ongoing transmissions
+	virtual void removeUePhy(MacNodeId ueId);
+
 	virtual void addTransmissionUl(MacNodeId ueId, MacNodeId destId, RbMap& rbMap, simtime_t endTime);
 
 	virtual void updateTransmissionUl();
+
+  protected:
+	// remove the bands whose transmission has ended by NOW
+	virtual void expireTransmissionUl();
+
+	// schedule the update tick at the next TTI boundary if it is not running
+	virtual void scheduleUpdateTick();
 };
 
 #endif
@@ -15,6 +15,8 @@
 //
 
 #include "mecrt/common/Database.h"
+#include "common/binder/Binder.h"
+#include "stack/phy/layer/LtePhyBase.h"
 #include <fstream>
 #include <queue>
 // #include <iostream>
@@ -27,6 +29,8 @@ Database::Database()
     errorInjectionTimer_ = nullptr;
     bnResyncTimer_ = nullptr;
     collectGrantedAppInfoTimer_ = nullptr;
+    vehicleRetireTimer_ = nullptr;
+    gnbGridIndex_ = nullptr;
 }
 
 Database::~Database()
@@ -52,6 +56,18 @@ Database::~Database()
         collectGrantedAppInfoTimer_ = nullptr;
     }
 
+    if (vehicleRetireTimer_)
+    {
+        cancelAndDelete(vehicleRetireTimer_);
+        vehicleRetireTimer_ = nullptr;
+    }
+
+    if (gnbGridIndex_)
+    {
+        delete gnbGridIndex_;
+        gnbGridIndex_ = nullptr;
+    }
+
     if (enableInitDebug_)
         std::cout << "Database::~Database - destroying Database module done!\n";
 }
@@ -80,6 +96,16 @@ void Database::initialize(int stage)
         numLinks_ = par("numLinks");
         failureRecoveryInterval_ = par("failureRecoveryInterval").doubleValue();
         routeUpdate_ = par("routeUpdate").boolValue();
+        gnbGridCellSize_ = par("gnbGridCellSize").doubleValue();
+        retireVehicles_ = par("retireVehicles").boolValue();
+        vehicleRetireDelay_ = par("vehicleRetireDelay").doubleValue();
+        // the binder keeps the UL allocations (with the UE PHY pointer) of the current and the previous TTI
+        if (retireVehicles_ && vehicleRetireDelay_ < 2 * TTI)
+            throw cRuntimeError("Database::initialize - vehicleRetireDelay %fs must cover the two TTIs (%fs) the binder keeps UL allocations for",
+                                vehicleRetireDelay_, 2 * TTI);
+        vehicleRetireQueue_.clear();
+        if (retireVehicles_)
+            vehicleRetireTimer_ = new omnetpp::cMessage("vehicleRetireTimer");
 
         appDataSize_.clear();
         ueExeTime_.clear();
@@ -179,6 +205,20 @@ void Database::handleMessage(omnetpp::cMessage *msg)
             grantedAppUtility_.clear();
             pendingScheduleApps_.clear();
         }
+        else if (msg == vehicleRetireTimer_)
+        {
+            EV << "Database::handleMessage - handling self message: " << msg->getName() << endl;
+            while (!vehicleRetireQueue_.empty() && vehicleRetireQueue_.begin()->first <= simTime())
+            {
+                cModule* vehicle = getSimulation()->getModule(vehicleRetireQueue_.begin()->second);
+                vehicleRetireQueue_.erase(vehicleRetireQueue_.begin());
+                if (vehicle != nullptr)
+                    retireVehicle(vehicle);
+            }
+
+            if (!vehicleRetireQueue_.empty())
+                scheduleAt(vehicleRetireQueue_.begin()->first, vehicleRetireTimer_);
+        }
     }
     else
     {
@@ -573,6 +613,35 @@ pair<double, double> Database::getGnbPosData(int gnbId)
     return gnbPosData_[gnbId];
 }
 
+/***
+ * the gNB positions are only final after the initialization of the mobility modules,
+ * so the index is built on the first query, from the PHY modules of the gNBs in the binder
+ */
+GnbGridIndex* Database::getGnbGridIndex()
+{
+    if (gnbGridIndex_)
+        return gnbGridIndex_;
+
+    gnbGridIndex_ = new GnbGridIndex(gnbGridCellSize_);
+    Binder* binder = getBinder();
+    std::vector<EnbInfo *>* gnbList = binder->getEnbList();
+    for (auto it = gnbList->begin(); it != gnbList->end(); ++it)
+    {
+        MacNodeId gnbId = (*it)->id;
+        cModule *gnb = getSimulation()->getModule(binder->getOmnetId(gnbId));
+        if (gnb == nullptr)
+            continue;
+
+        LtePhyBase *gnbPhy = (isNrUe(gnbId)) ? check_and_cast<LtePhyBase *>(gnb->getSubmodule("cellularNic")->getSubmodule("nrPhy"))
+                                            : check_and_cast<LtePhyBase *>(gnb->getSubmodule("cellularNic")->getSubmodule("phy"));
+        gnbGridIndex_->addGnb(gnbId, *it, gnbPhy);
+    }
+
+    EV << "Database::getGnbGridIndex - built the gNB grid index with " << gnbGridIndex_->size() << " gNBs" << endl;
+
+    return gnbGridIndex_;
+}
+
 string Database::sampleDeviceType()
 {
     // sample a device type based on a uniform distribution
@@ -580,3 +649,51 @@ string Database::sampleDeviceType()
     return deviceTypes_[typeId];
 }
 
+
+
+void Database::scheduleVehicleRetire(cModule* vehicle, simtime_t stopTime)
+{
+    if (!retireVehicles_)
+        return;
+
+    simtime_t retireTime = stopTime + vehicleRetireDelay_;
+    vehicleRetireQueue_.insert({retireTime, vehicle->getId()});
+
+    // the timer always points to the earliest retire time
+    if (vehicleRetireTimer_->isScheduled() && vehicleRetireTimer_->getArrivalTime() <= retireTime)
+        return;
+    cancelEvent(vehicleRetireTimer_);
+    scheduleAt(std::max(retireTime, simTime()), vehicleRetireTimer_);
+}
+
+void Database::retireVehicle(cModule* vehicle)
+{
+    Binder* binder = getBinder();
+    MacNodeId nodeId = vehicle->hasPar("nrMacNodeId") ? (MacNodeId)vehicle->par("nrMacNodeId").intValue() : 0;
+
+    EV << "Database::retireVehicle - vehicle " << vehicle->getFullName() << " (node " << nodeId << ") left the simulation" << endl;
+
+    // the layers release their per-UE state in the gNBs and global modules in finish(),
+    // since this is not the end of the simulation (see UeMac::finish and UePhy::finish)
+    vehicle->callFinish();
+
+    if (nodeId > 0)
+    {
+        std::vector<UeInfo*>* ueList = binder->getUeList();
+        for (auto it = ueList->begin(); it != ueList->end(); ++it)
+        {
+            if ((*it)->id == nodeId)
+            {
+                delete *it;
+                ueList->erase(it);
+                break;
+            }
+        }
+
+        // the schedulers treat nodes without omnet id as left the simulation
+        if (binder->getOmnetId(nodeId) != 0)
+            binder->unregisterNode(nodeId);
+    }
+
+    vehicle->deleteModule();
+}
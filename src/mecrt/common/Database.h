@@ -21,6 +21,7 @@
 #include <inet/common/INETDefs.h>
 #include "common/LteCommon.h"
 #include "mecrt/common/NodeInfo.h"
+#include "mecrt/common/GnbGridIndex.h"
 
 using namespace omnetpp;
 using namespace std;
@@ -48,6 +49,8 @@ class Database : public omnetpp::cSimpleModule
     map<string, double> gnbServiceAccuracy_; // store the service accuracy
     set<string> gnbServices_; // store the gNB services
     map<int, pair<double, double>> gnbPosData_; // store the gNB position data
+    GnbGridIndex* gnbGridIndex_; // spatial index of the gNBs, built on first use
+    double gnbGridCellSize_; // the cell size of the gNB grid index (m)
     vector<string> deviceTypes_; // store the device types
 
     // store the gNB data
@@ -78,6 +81,17 @@ class Database : public omnetpp::cSimpleModule
     omnetpp::simsignal_t grantedAppCountSignal_;
     omnetpp::simsignal_t pendingScheduleAppSignal_;
 
+    /***
+     * vehicle retirement: a vehicle whose trace has ended is finished and deleted from the network
+     * vehicleRetireDelay_ (at least 2 TTIs) after its last waypoint, which releases its memory and its
+     * per-UE state in the gNBs. All vehicles are still created at initialization, so the peak memory
+     * scales with the whole fleet.
+     */
+    bool retireVehicles_;
+    double vehicleRetireDelay_;
+    multimap<simtime_t, int> vehicleRetireQueue_;  // {retire time: vehicle module id}
+    omnetpp::cMessage* vehicleRetireTimer_;
+
     // define a map for application deadline
     const map<string, double> appDeadline = {
         {"resnet18", 0.06}, // 60ms
@@ -118,6 +132,8 @@ class Database : public omnetpp::cSimpleModule
     virtual double getGnbExeTime(string appType, string deviceType);
     virtual double getGnbServiceAccuracy(string appType);
     virtual pair<double, double> getGnbPosData(int gnbId);
+    // get the spatial index of all gNBs registered in the binder
+    virtual GnbGridIndex* getGnbGridIndex();
     virtual string sampleDeviceType();
     // TODO: change to app dependent service types in the future
     virtual set<string> getGnbServiceTypes() const { return gnbServices_; }
@@ -139,6 +155,13 @@ class Database : public omnetpp::cSimpleModule
     void addGrantedAppInfo(map<AppId, double>& newGrantedAppUtility);
 
     void addPendingScheduleApps(set<AppId>& newPendingScheduleApps);
+
+    // register a vehicle to be deleted after its trace ends at stopTime (no effect if retireVehicles is false)
+    virtual void scheduleVehicleRetire(cModule* vehicle, simtime_t stopTime);
+
+  protected:
+    // finish and delete the vehicle module, unregistering it from the binder
+    virtual void retireVehicle(cModule* vehicle);
 };
 
 #endif  // _MEC_DATABASE_H_
@@ -0,0 +1,105 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    GnbGridIndex.cc / GnbGridIndex.h
+//
+//  Description:
+//    A uniform grid index of the gNB positions. gNBs are stationary, so the index is built
+//    once and shared by all UEs (hosted by the Database module). It answers the query
+//    "gNBs within distance r of position p, sorted by distance" and caches the PHY module
+//    of each gNB, so that the UE does not need to resolve the gNB modules on every feedback.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#include "mecrt/common/GnbGridIndex.h"
+#include "stack/phy/layer/LtePhyBase.h"
+
+GnbGridIndex::GnbGridIndex(double cellSize)
+{
+    if (cellSize <= 0)
+        throw omnetpp::cRuntimeError("GnbGridIndex::GnbGridIndex - the cell size must be positive, got %f", cellSize);
+
+    cellSize_ = cellSize;
+}
+
+void GnbGridIndex::addGnb(MacNodeId id, EnbInfo* info, LtePhyBase* phy)
+{
+    if (idToIndex_.find(id) != idToIndex_.end())
+        return;
+
+    GnbIndexEntry entry;
+    entry.id = id;
+    entry.info = info;
+    entry.phy = phy;
+    entry.coord = phy->getCoord();
+
+    int index = entries_.size();
+    entries_.push_back(entry);
+    idToIndex_[id] = index;
+    grid_[make_pair(toCell(entry.coord.x), toCell(entry.coord.y))].push_back(index);
+}
+
+void GnbGridIndex::queryRange(const inet::Coord& pos, double radius, vector<pair<double, MacNodeId>>& result) const
+{
+    result.clear();
+
+    // the cells covering the square [x-r, x+r] x [y-r, y+r]; scan all gNBs if it is larger than the grid itself
+    long minX = 0, maxX = -1, minY = 0, maxY = -1;
+    if (radius >= 0)
+    {
+        minX = toCell(pos.x - radius);
+        maxX = toCell(pos.x + radius);
+        minY = toCell(pos.y - radius);
+        maxY = toCell(pos.y + radius);
+    }
+
+    if (radius < 0 || (maxX - minX + 1) * (maxY - minY + 1) >= (long)grid_.size())
+    {
+        for (const GnbIndexEntry& entry : entries_)
+        {
+            double dist = entry.coord.distance(pos);
+            if (radius < 0 || dist <= radius)
+                result.push_back(make_pair(dist, entry.id));
+        }
+    }
+    else
+    {
+        for (long cx = minX; cx <= maxX; ++cx)
+        {
+            for (long cy = minY; cy <= maxY; ++cy)
+            {
+                auto cellIt = grid_.find(make_pair((int)cx, (int)cy));
+                if (cellIt == grid_.end())
+                    continue;
+
+                for (int index : cellIt->second)
+                {
+                    // the grid is 2D, the distance includes the height difference
+                    double dist = entries_[index].coord.distance(pos);
+                    if (dist <= radius)
+                        result.push_back(make_pair(dist, entries_[index].id));
+                }
+            }
+        }
+    }
+
+    sort(result.begin(), result.end());
+}
+
+const GnbIndexEntry* GnbGridIndex::getGnb(MacNodeId id) const
+{
+    auto it = idToIndex_.find(id);
+    if (it == idToIndex_.end())
+        return nullptr;
+
+    return &entries_[it->second];
+}
+
+LtePhyBase* GnbGridIndex::getGnbPhy(MacNodeId id) const
+{
+    const GnbIndexEntry* entry = getGnb(id);
+    return entry ? entry->phy : nullptr;
+}
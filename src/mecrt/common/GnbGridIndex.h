@@ -0,0 +1,66 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    GnbGridIndex.cc / GnbGridIndex.h
+//
+//  Description:
+//    A uniform grid index of the gNB positions. gNBs are stationary, so the index is built
+//    once and shared by all UEs (hosted by the Database module). It answers the query
+//    "gNBs within distance r of position p, sorted by distance" and caches the PHY module
+//    of each gNB, so that the UE does not need to resolve the gNB modules on every feedback.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#ifndef _MECRT_COMMON_GNBGRIDINDEX_H_
+#define _MECRT_COMMON_GNBGRIDINDEX_H_
+
+#include <omnetpp.h>
+#include <inet/common/INETDefs.h>
+#include "inet/common/geometry/common/Coord.h"
+#include "common/LteCommon.h"
+
+using namespace std;
+
+class LtePhyBase;
+
+struct GnbIndexEntry
+{
+    MacNodeId id;
+    EnbInfo* info;      // the EnbInfo registered in the binder
+    LtePhyBase* phy;    // the PHY module of the gNB
+    inet::Coord coord;  // the position of the gNB
+};
+
+class GnbGridIndex
+{
+  protected:
+    double cellSize_;   // the side length of a grid cell (m)
+    vector<GnbIndexEntry> entries_;
+    map<MacNodeId, int> idToIndex_;   // {gnbId: index in entries_}
+    map<pair<int, int>, vector<int>> grid_;    // {(cellX, cellY): [index in entries_]}
+
+    int toCell(double v) const { return static_cast<int>(floor(v / cellSize_)); }
+
+  public:
+    GnbGridIndex(double cellSize);
+
+    // add a gNB to the index, the position is read from the PHY module
+    void addGnb(MacNodeId id, EnbInfo* info, LtePhyBase* phy);
+
+    /***
+     * collect the gNBs whose distance to pos is not larger than radius, as (distance, gnbId) pairs
+     * sorted by distance (ties by gnbId). A negative radius returns all gNBs.
+     */
+    void queryRange(const inet::Coord& pos, double radius, vector<pair<double, MacNodeId>>& result) const;
+
+    // return nullptr if the gNB is not indexed
+    const GnbIndexEntry* getGnb(MacNodeId id) const;
+    LtePhyBase* getGnbPhy(MacNodeId id) const;
+
+    int size() const { return entries_.size(); }
+};
+
+#endif  // _MECRT_COMMON_GNBGRIDINDEX_H_
@@ -30,4 +30,35 @@ extern double NEXT_SCHEDULING_TIME; // definition, use a large value initially
 
 typedef unsigned int AppId;
 
+/***
+ * bitmask of bands within one carrier, bit i is set if band i is included
+ * a carrier can hold at most MEC_MAX_BANDS bands in this representation
+ */
+typedef uint64_t BandMask;
+static const int MEC_MAX_BANDS = 64;
+
+inline BandMask bandToMask(Band band) { return BandMask(1) << band; }
+inline bool maskHasBand(BandMask mask, Band band) { return (mask >> band) & 1; }
+inline int countBands(BandMask mask) { return __builtin_popcountll(mask); }
+inline Band lowestBand(BandMask mask) { return static_cast<Band>(__builtin_ctzll(mask)); }
+
+// mask of all bands in [0, numBands)
+inline BandMask fullBandMask(int numBands)
+{
+    return (numBands >= MEC_MAX_BANDS) ? ~BandMask(0) : ((BandMask(1) << numBands) - 1);
+}
+
+// pick the numBands lowest bands from mask (same order as iterating a std::set<Band>)
+inline BandMask lowestBands(BandMask mask, int numBands)
+{
+    BandMask picked = 0;
+    for (int i = 0; i < numBands && mask; i++)
+    {
+        BandMask bit = mask & (~mask + 1);
+        picked |= bit;
+        mask ^= bit;
+    }
+    return picked;
+}
+
 #endif // _MECRT_MECCOMMON_H_
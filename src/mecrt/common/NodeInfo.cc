@@ -428,6 +428,9 @@ void NodeInfo::handleIfUpTimer()
                 dataChannel->setDisabled(false); // enable the channel to simulate interface recovery
                 EV << "NodeInfo:handleIfUpTimer - recover link connected to interface " << ifId << "\n";
                 linkRecovered = true;
+
+                if (ospf_)
+                    ospf_->handleLinkUp(ie);
             }
         }
     }
@@ -513,6 +516,9 @@ void NodeInfo::handleIfDownTimer()
                 dataChannel->setDisabled(true); // disable the channel to simulate interface failure
                 EV << "NodeInfo:handleIfDownTimer - disable link connected to interface " << ifId << "\n";
                 linkFailed = true;
+
+                if (ospf_)
+                    ospf_->handleLinkDown(ie); // switch to loop-free alternates until the routes are recomputed
             }
         }
     }
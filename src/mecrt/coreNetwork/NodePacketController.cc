@@ -34,8 +34,9 @@ NodePacketController::NodePacketController()
     localPort_ = -1;
     nodeInfo_ = nullptr;
     enableInitDebug_ = false;
+    digestTimer_ = nullptr;
 
-    srvReqsBuffer_.clear();
+    srvReqCache_.clear();
 }
 
 NodePacketController::~NodePacketController()
@@ -43,6 +44,11 @@ NodePacketController::~NodePacketController()
     if (enableInitDebug_)
         std::cout << "NodePacketController::~NodePacketController - destroying NodePacketController module\n";
 
+    if (digestTimer_)
+    {
+        cancelAndDelete(digestTimer_);
+        digestTimer_ = nullptr;
+    }
 
     if (enableInitDebug_)
         std::cout << "NodePacketController::~NodePacketController - destroying NodePacketController module done!\n";
@@ -64,6 +70,32 @@ void NodePacketController::initialize(int stage)
 
         localPort_ = MEC_NPC_PORT; // default(37);
 
+        string dissemination = par("srvReqDissemination").stdstringValue();
+        if (dissemination == "flood")
+            dissemination_ = SRV_REQ_FLOOD;
+        else if (dissemination == "scoped")
+            dissemination_ = SRV_REQ_SCOPED;
+        else if (dissemination == "unicast")
+            dissemination_ = SRV_REQ_UNICAST;
+        else
+            throw cRuntimeError("NodePacketController::initialize - unknown srvReqDissemination %s", dissemination.c_str());
+
+        maxHops_ = par("maxHops");
+        if (maxHops_ < 0)
+        {
+            // the requests should reach the RSUs the scheduler may forward the job to
+            cModule* scheduler = getParentModule()->getSubmodule("scheduler");
+            maxHops_ = (scheduler != nullptr) ? scheduler->par("maxHops").intValue() : 0;
+        }
+        if (dissemination_ == SRV_REQ_SCOPED && maxHops_ <= 0)
+            throw cRuntimeError("NodePacketController::initialize - the scoped srvReqDissemination needs maxHops > 0");
+        digestInterval_ = par("srvReqDigestInterval");
+        srvReqCacheSize_ = par("srvReqCacheSize");
+        if (srvReqCacheSize_ <= 0)
+            throw cRuntimeError("NodePacketController::initialize - srvReqCacheSize must be positive");
+
+        digestTimer_ = new cMessage("srvReqDigestTimer");
+
         if (enableInitDebug_)
             std::cout << "NodePacketController::initialize - INITSTAGE_LOCAL end" << endl;
     }
@@ -88,7 +120,8 @@ void NodePacketController::initialize(int stage)
         WATCH_PTR(nodeInfo_);
         WATCH(localPort_);
         WATCH(socketId_);
-        WATCH_MAP(srvReqsBuffer_);
+        WATCH(maxHops_);
+        WATCH(srvReqSerial_);
 
         if (enableInitDebug_)
             std::cout << "NodePacketController::initialize - INITSTAGE_APPLICATION_LAYER end" << endl;
@@ -101,8 +134,10 @@ void NodePacketController::handleMessage(cMessage *msg)
     // self message
     if (msg->isSelfMessage())
     {
-        // do nothing for now
-        EV << "NodePacketController::handleMessage - received self-message: " << msg->getName() << endl;
+        if (msg == digestTimer_)
+            sendServiceRequestDigests();
+        else
+            EV << "NodePacketController::handleMessage - received self-message: " << msg->getName() << endl;
     }
     else
     {
@@ -118,7 +153,8 @@ void NodePacketController::handleMessage(cMessage *msg)
             pkt = nullptr;
             return;
         }
-        else if (strcmp(pkt->getName(), "RsuFD") == 0)
+        else if (strcmp(pkt->getName(), "RsuFD") == 0 || strcmp(pkt->getName(), "RsuFDBatch") == 0
+                || strcmp(pkt->getName(), "SrvGrantAck") == 0)
         {
             // in our current design, if the RsuED is generated by the local NIC, it will be send to the server module directly
             // if it is generated by the remote NIC (e.g., from another gnb), it will be sent to its local server first, which then
@@ -146,6 +182,11 @@ void NodePacketController::handleMessage(cMessage *msg)
             handleServiceGrant(pkt);
             return;
         }
+        else if (strcmp(pkt->getName(), "SrvGrantBatch") == 0) // batch of service grants from the global scheduler
+        {
+            handleServiceGrantBatch(pkt);
+            return;
+        }
         else if (strcmp(pkt->getName(), "SrvFD") == 0) // service feedback packet from the local scheduler
         {
             handleServiceFeedback(pkt);
@@ -194,98 +235,216 @@ void NodePacketController::handleServiceFeedback(inet::Packet *packet)
 void NodePacketController::handleServiceRequest(Packet *pkt)
 {
     /***
-     * When receive a service request packet from the UE, create two copies of the packet:
-     * 1) one is sent to the global scheduler (if it exists)
-     * 2) the other is sent to the local scheduler
-     * if local scheduler is voted as the global scheduler, then only one copy is sent to the local scheduler
+     * A packet from the UE carries one service request, a packet from another gNB may carry
+     * a digest of several requests. For each new request:
+     * 1) a copy is sent to the local scheduler
+     * 2) a copy is kept in srvReqCache_ in case the global scheduler changes later
+     * 3) the request is disseminated to other gNBs according to srvReqDissemination
      */
-    auto srvReq = pkt->peekAtFront<VecRequest>();
+    uint32_t srcAddr = pkt->getTag<L3AddressInd>()->getSrcAddress().toIpv4().getInt();
+    while (pkt->getDataLength() > b(0))
+    {
+        Ptr<VecRequest> srvReq = makeShared<VecRequest>(*pkt->popAtFront<VecRequest>());
+        uint32_t senderAddr = srcAddr;
+        if (srvReq->getUeIpAddress() == 0)
+        {
+            EV << NOW << " NodePacketController::handleServiceRequest - fill in the UE IP address in the service request packet." << endl;
+            // the request is received from the UE, the source address of the packet is the UE address
+            srvReq->setUeIpAddress(srcAddr);
+            srvReq->setHopCount(0);
+            senderAddr = 0;
+        }
+        handleServiceRequest(srvReq, senderAddr);
+    }
+}
+
+
+void NodePacketController::handleServiceRequest(Ptr<VecRequest> srvReq, uint32_t senderAddr)
+{
     AppId appId = srvReq->getAppId();
-    EV << NOW << " NodePacketController::handleServiceRequest - Received a service request packet for app " << appId << endl;
+    EV << NOW << " NodePacketController::handleServiceRequest - Received a service request packet for app " << appId 
+        << ", hop count " << srvReq->getHopCount() << endl;
 
-    // check if the service request for this app has been buffered
-    if (srvReqsBuffer_.find(appId) != srvReqsBuffer_.end())
+    // in the unicast dissemination the sender may not be a neighbor, and the sent mask is not used
+    int slot = (dissemination_ == SRV_REQ_UNICAST) ? -1 : getNeighborSlot(senderAddr);
+    auto it = srvReqCache_.find(appId);
+    if (it != srvReqCache_.end())
     {
+        SrvReqEntry& entry = it->second;
+        if (slot >= 0)
+            entry.sentMask |= (uint64_t)1 << slot;  // no need to send it back to the sender
+
+        // in the scoped dissemination, a shorter path extends the scope of the request beyond this node
+        if (dissemination_ == SRV_REQ_SCOPED && senderAddr != 0 && srvReq->getHopCount() < entry.srvReq->getHopCount())
+        {
+            EV << NOW << " NodePacketController::handleServiceRequest - shorter path to app " << appId 
+                << ", hop count " << entry.srvReq->getHopCount() << " -> " << srvReq->getHopCount() << endl;
+            entry.srvReq = srvReq;
+            entry.sentMask = (slot >= 0) ? ((uint64_t)1 << slot) : 0;
+            disseminateServiceRequest(entry);
+            return;
+        }
+
         EV << NOW << " NodePacketController::handleServiceRequest - Service request for app " << appId 
             << " has been buffered, ignore the new request." << endl;
         return;
     }
 
-    Ptr<VecRequest> srvReqCopy = makeShared<VecRequest>(*srvReq);
-    int ueAddr = srvReq->getUeIpAddress();
-    if (ueAddr == 0)
-    {
-        EV << NOW << " NodePacketController::handleServiceRequest - fill in the UE IP address in the service request packet." << endl;
-        // get ipv4 address of the ue from the VecRequest packet tag
-        auto ueIpAddress = pkt->getTag<L3AddressInd>()->getSrcAddress().toIpv4();
-        srvReqCopy->setUeIpAddress(ueIpAddress.getInt());
-        // if want to get the src port, use pkt->getTag<L4PortInd>()->getSrcPort()
-    }
-    srvReqsBuffer_[appId] = srvReqCopy; // buffer the request in case the global scheduler recovers later
-    
+    SrvReqEntry& entry = cacheServiceRequest(srvReq);
+    if (slot >= 0)
+        entry.sentMask |= (uint64_t)1 << slot;
+
     // create a copy of the service request packet for the local scheduler
     EV << NOW << " NodePacketController::handleServiceRequest - send a copy of the service request packet to the local scheduler." << endl;
     Packet* packetToLocal = new Packet("SrvReq");
-    packetToLocal->insertAtBack(srvReqCopy);
+    packetToLocal->insertAtBack(srvReq);
     // bypass the udp socket, send the packet to the local application
     packetToLocal->addTagIfAbsent<SocketInd>()->setSocketId(nodeInfo_->getLocalSchedulerSocketId());
     send(packetToLocal, "socketOut");
 
-    // broadcast the service request to all neighbors
-    if (!nodeInfo_->getNeighborAddrs().empty())
+    disseminateServiceRequest(entry);
+}
+
+
+NodePacketController::SrvReqEntry& NodePacketController::cacheServiceRequest(Ptr<VecRequest> srvReq)
+{
+    // drop the oldest requests if the cache is full, skipping the order records of requests already removed
+    while (!srvReqOrder_.empty())
     {
-        EV << NOW << " NodePacketController::handleServiceRequest - broadcast a copy of the service request packet to all neighbor nodes." << endl;
-        if (ueAddr == 0)    // this is received from UE, broadcast to all neighbors
+        auto front = srvReqOrder_.front();
+        auto it = srvReqCache_.find(front.first);
+        bool stale = (it == srvReqCache_.end() || it->second.serial != front.second);
+        if (!stale && (int)srvReqCache_.size() < srvReqCacheSize_)
+            break;
+
+        srvReqOrder_.pop_front();
+        if (!stale)
         {
-            for (const auto& pair : nodeInfo_->getNeighborAddrs())
-            {   
-                // check if the interface is active
-                NetworkInterface* ni = pair.second;
-                if (!ni || !ni->isUp() || ni->isWireless())
-                    continue;
-                
-                Packet* packetToNeighbor = new Packet("SrvReq");
-                packetToNeighbor->insertAtBack(srvReqsBuffer_[appId]);
-                socket_.sendTo(packetToNeighbor, Ipv4Address(pair.first), MEC_NPC_PORT);
-                broadcastedSrvReqs_[appId].insert(pair.first);
-            }
+            EV << NOW << " NodePacketController::cacheServiceRequest - cache full, drop the request of app " << front.first << endl;
+            srvReqCache_.erase(it);
         }
-        else
+    }
+
+    SrvReqEntry& entry = srvReqCache_[srvReq->getAppId()];
+    entry.srvReq = srvReq;
+    entry.sentMask = 0;
+    entry.sentToGlobal = 0;
+    entry.serial = ++srvReqSerial_;
+    srvReqOrder_.push_back({srvReq->getAppId(), entry.serial});
+    return entry;
+}
+
+
+void NodePacketController::disseminateServiceRequest(SrvReqEntry& entry)
+{
+    Ptr<VecRequest> srvReq = entry.srvReq;
+    AppId appId = srvReq->getAppId();
+    Ptr<VecRequest> srvReqFwd = nullptr;    // the copy sent to other gNBs, with one more hop
+
+    if (dissemination_ == SRV_REQ_UNICAST)
+    {
+        // only the gNB that received the request from the UE sends it to the global scheduler
+        if (nodeInfo_->getIsGlobalScheduler() || srvReq->getHopCount() > 0)
+            return;
+
+        Ipv4Address globalAddr = nodeInfo_->getGlobalSchedulerAddr();
+        if (globalAddr.isUnspecified())
         {
-            // this is received from other gNB, only broadcast to neighbors that have not received it yet
-            int na = pkt->getTag<L3AddressInd>()->getSrcAddress().toIpv4().getInt();
-            for (const auto& pair : nodeInfo_->getNeighborAddrs())
-            {
-                if (na == pair.first)
-                {
-                    broadcastedSrvReqs_[appId].insert(pair.first);
-                    continue; // do not send back to the sender
-                }
-
-                if (broadcastedSrvReqs_[appId].find(pair.first) != broadcastedSrvReqs_[appId].end())
-                    continue; // already broadcasted to this neighbor
-
-                // check if the neighbor address is reachable
-                NetworkInterface* ni = pair.second;
-                if (!ni || !ni->isUp() || ni->isWireless())
-                    continue;
-
-                Packet* packetToNeighbor = new Packet("SrvReq");
-                packetToNeighbor->insertAtBack(srvReqsBuffer_[appId]);
-                socket_.sendTo(packetToNeighbor, Ipv4Address(pair.first), MEC_NPC_PORT);
-                broadcastedSrvReqs_[appId].insert(pair.first);
-            }
+            EV << NOW << " NodePacketController::disseminateServiceRequest - no global scheduler yet, keep the request of app " << appId << endl;
+            return;
         }
+        if (entry.sentToGlobal == globalAddr.getInt())
+            return;
+
+        EV << NOW << " NodePacketController::disseminateServiceRequest - send the request of app " << appId 
+            << " to the global scheduler " << globalAddr << endl;
+        srvReqFwd = makeShared<VecRequest>(*srvReq);
+        srvReqFwd->setHopCount(srvReq->getHopCount() + 1);
+        sendServiceRequest(globalAddr.getInt(), srvReqFwd);
+        entry.sentToGlobal = globalAddr.getInt();
+        return;
     }
 
-    // send a copy to the global scheduler (if it exists)
-    // if (!nodeInfo_->getIsGlobalScheduler() && !nodeInfo_->getGlobalSchedulerAddr().isUnspecified())
-    // {
-    //     EV << NOW << " NodePacketController::handleServiceRequest - send a copy of the service request packet to the global scheduler." << endl;
-    //     Packet* packetToGlobal = new Packet("SrvReq");
-    //     packetToGlobal->insertAtBack(srvReqsBuffer_[appId]);
-    //     socket_.sendTo(packetToGlobal, nodeInfo_->getGlobalSchedulerAddr(), MEC_NPC_PORT);
-    // }
+    if (dissemination_ == SRV_REQ_SCOPED && srvReq->getHopCount() >= maxHops_)
+    {
+        EV << NOW << " NodePacketController::disseminateServiceRequest - request of app " << appId 
+            << " reaches the hop limit " << maxHops_ << ", stop forwarding." << endl;
+        return;
+    }
+
+    for (const auto& pair : nodeInfo_->getNeighborAddrs())
+    {
+        // check if the interface is active
+        NetworkInterface* ni = pair.second;
+        if (!ni || !ni->isUp() || ni->isWireless())
+            continue;
+
+        int slot = getNeighborSlot(pair.first);
+        if (slot >= 0 && (entry.sentMask & ((uint64_t)1 << slot)))
+            continue; // already sent to this neighbor
+
+        if (!srvReqFwd)
+        {
+            srvReqFwd = makeShared<VecRequest>(*srvReq);
+            srvReqFwd->setHopCount(srvReq->getHopCount() + 1);
+        }
+        sendServiceRequest(pair.first, srvReqFwd);
+        if (slot >= 0)
+            entry.sentMask |= (uint64_t)1 << slot;
+    }
+}
+
+
+void NodePacketController::sendServiceRequest(uint32_t destAddr, Ptr<VecRequest> srvReq)
+{
+    if (digestInterval_ > 0)
+    {
+        pendingDigest_[destAddr].push_back(srvReq);
+        if (!digestTimer_->isScheduled())
+            scheduleAt(simTime() + digestInterval_, digestTimer_);
+        return;
+    }
+
+    Packet* packet = new Packet("SrvReq");
+    packet->insertAtBack(srvReq);
+    socket_.sendTo(packet, Ipv4Address(destAddr), MEC_NPC_PORT);
+}
+
+
+void NodePacketController::sendServiceRequestDigests()
+{
+    for (auto& pair : pendingDigest_)
+    {
+        if (pair.second.empty())
+            continue;
+
+        EV << NOW << " NodePacketController::sendServiceRequestDigests - send " << pair.second.size() 
+            << " service requests to " << Ipv4Address(pair.first) << endl;
+        Packet* packet = new Packet("SrvReq");
+        for (auto& srvReq : pair.second)
+            packet->insertAtBack(srvReq);
+        socket_.sendTo(packet, Ipv4Address(pair.first), MEC_NPC_PORT);
+    }
+    pendingDigest_.clear();
+}
+
+
+int NodePacketController::getNeighborSlot(int neighborAddr)
+{
+    if (neighborAddr == 0)
+        return -1;
+
+    auto it = neighborSlot_.find(neighborAddr);
+    if (it != neighborSlot_.end())
+        return it->second;
+
+    // the sent mask has 64 bits, further neighbors are never marked (their duplicates are dropped at the receiver)
+    if (neighborSlot_.size() >= 64)
+        return -1;
+
+    int slot = neighborSlot_.size();
+    neighborSlot_[neighborAddr] = slot;
+    return slot;
 }
 
 
@@ -327,6 +486,50 @@ void NodePacketController::handleServiceGrant(Packet *pkt)
 }
 
 
+void NodePacketController::handleServiceGrantBatch(Packet *pkt)
+{
+    auto batch = pkt->peekAtFront<Grant2RsuBatch>();
+    MacNodeId processGnbId = batch->getProcessGnbId();
+    EV << NOW << " NodePacketController::handleFromUdp - Received grant batch " << batch->getBatchId() 
+        << " with " << batch->getNumGrants() << " grants" << endl;
+
+    if (processGnbId == nodeInfo_->getNodeId() && !nodeInfo_->getIsGlobalScheduler())
+    {
+        EV << NOW << " NodePacketController::handleFromUdp - the processing RSU is the local RSU, send to local processing module" << endl;
+        pkt->clearTags(); // clear all tags first
+        pkt->addTagIfAbsent<SocketInd>()->setSocketId(nodeInfo_->getServerSocketId());
+        send(pkt, "socketOut");
+        return;
+    }
+
+    EV << NOW << " NodePacketController::handleFromUdp - the processing RSU is not the local RSU, service initialization fails!" << endl;
+
+    auto header = pkt->popAtFront<Grant2RsuBatch>();
+    while (pkt->getDataLength() > b(0))
+    {
+        auto srvGrant = pkt->popAtFront<Grant2Rsu>();
+        Packet* packet = new Packet("SrvFD");
+        auto srvStatus = makeShared<ServiceStatus>();
+        srvStatus->setSuccess(false);
+        srvStatus->setAppId(srvGrant->getAppId());
+        srvStatus->setProcessGnbId(processGnbId);
+        srvStatus->setOffloadGnbId(srvGrant->getOffloadGnbId());
+        srvStatus->setProcessGnbCuUpdateTime(0);
+        srvStatus->setOffloadGnbRbUpdateTime(0);
+        packet->insertAtFront(srvStatus);
+        socket_.sendTo(packet, nodeInfo_->getGlobalSchedulerAddr(), MEC_NPC_PORT);
+    }
+
+    // the batch has been answered, acknowledge it so that it is not resent
+    Packet* ack = new Packet("SrvGrantAck");
+    ack->insertAtFront(makeShared<Grant2RsuBatch>(*header));
+    socket_.sendTo(ack, nodeInfo_->getGlobalSchedulerAddr(), MEC_NPC_PORT);
+
+    delete pkt;
+    pkt = nullptr;
+}
+
+
 void NodePacketController::handleOffloadingNicGrant(Packet *pkt)
 {
     auto nicGrant = pkt->peekAtFront<Grant2Veh>();
@@ -368,52 +571,33 @@ void NodePacketController::recoverServiceRequests()
     // Enter_Method or Enter_Method_Silent to tell the simulation kernel "switch context to this module"
     Enter_Method("recoverServiceRequests");
 
-    // resend all buffered service request packets to the global scheduler
-    // if (nodeInfo_->getIsGlobalScheduler())
-    //     return;
-
-    // if (nodeInfo_->getGlobalSchedulerAddr().isUnspecified())
-    //     return;
-
-    if (srvReqsBuffer_.empty())
+    if (srvReqCache_.empty())
     {
         EV << NOW << " NodePacketController::recoverServiceRequests - no buffered service request packets to resend." << endl;
         return;
     }
 
-    EV << NOW << " NodePacketController::recoverServiceRequests - check if we need to broadcast any service requests." << endl;
-    vector<AppId> toRemove; // remove terminated requests
-    for (const auto& pair : nodeInfo_->getNeighborAddrs())
+    // remove terminated requests
+    for (auto it = srvReqCache_.begin(); it != srvReqCache_.end();)
     {
-        // check if the neighbor address is reachable
-        NetworkInterface* ni = pair.second;
-        if (!ni || !ni->isUp() || ni->isWireless())
-            continue;
-
-        for (auto it = srvReqsBuffer_.begin(); it != srvReqsBuffer_.end(); ++it)
-        {
-            AppId appId = it->first;
-            Ptr<VecRequest> srvReq = it->second;
-            if (srvReq->getStopTime() <= simTime())
-            {
-                toRemove.push_back(appId);
-                continue;
-            }
-            if (broadcastedSrvReqs_[appId].find(pair.first) != broadcastedSrvReqs_[appId].end())
-                continue; // already broadcasted to this neighbor
-
-            Packet* packetToNeighbor = new Packet("SrvReq");
-            packetToNeighbor->insertAtBack(srvReqsBuffer_[appId]);
-            socket_.sendTo(packetToNeighbor, Ipv4Address(pair.first), MEC_NPC_PORT);
-            broadcastedSrvReqs_[appId].insert(pair.first);
-        }
+        if (it->second.srvReq->getStopTime() <= simTime())
+            it = srvReqCache_.erase(it);
+        else
+            ++it;
+    }
 
-        for (auto appId : toRemove)
-        {
-            srvReqsBuffer_.erase(appId);
-            broadcastedSrvReqs_.erase(appId);
-        }
-        toRemove.clear();
+    deque<pair<AppId, uint64_t>> order;
+    for (const auto& record : srvReqOrder_)
+    {
+        auto it = srvReqCache_.find(record.first);
+        if (it != srvReqCache_.end() && it->second.serial == record.second)
+            order.push_back(record);
     }
-}
+    srvReqOrder_.swap(order);
 
+    // send the requests to the new neighbors, or to the new global scheduler
+    EV << NOW << " NodePacketController::recoverServiceRequests - check if we need to resend any of the " 
+        << srvReqCache_.size() << " service requests." << endl;
+    for (const auto& record : srvReqOrder_)
+        disseminateServiceRequest(srvReqCache_[record.first]);
+}
@@ -17,6 +17,8 @@
 #define __MECRT_NODE_PACKET_CONTROLLER_H_
 
 #include <omnetpp.h>
+#include <deque>
+#include <unordered_map>
 #include "inet/transportlayer/contract/udp/UdpSocket.h"
 #include <inet/linklayer/common/InterfaceTag_m.h>
 #include "inet/common/socket/SocketTag_m.h"
@@ -41,8 +43,26 @@ class NodePacketController : public omnetpp::cSimpleModule
     bool enableInitDebug_ = false;
 
     // =========== UE application related ===========
-    map<AppId, Ptr<VecRequest>> srvReqsBuffer_; // service requests buffer for global scheduler recovery
-    map<AppId, set<int>> broadcastedSrvReqs_; // set of AppIds that have been broadcasted to other nodes
+    enum SrvReqDissemination { SRV_REQ_FLOOD, SRV_REQ_SCOPED, SRV_REQ_UNICAST };
+    SrvReqDissemination dissemination_ = SRV_REQ_FLOOD;
+    int maxHops_ = 0;       // hop limit of the scoped dissemination
+    simtime_t digestInterval_;  // batching interval of the requests sent to the same destination, 0 to send at once
+    int srvReqCacheSize_ = 4096;    // maximum number of requests in srvReqCache_
+
+    struct SrvReqEntry
+    {
+        Ptr<VecRequest> srvReq;     // hopCount is the number of hops from the receiving RSU to this node
+        uint64_t sentMask = 0;      // the neighbors (bit of neighborSlot_) that have got the request
+        uint32_t sentToGlobal = 0;  // the global scheduler address the request was unicast to
+        uint64_t serial = 0;        // insertion serial, to match the entry in srvReqOrder_
+    };
+    unordered_map<AppId, SrvReqEntry> srvReqCache_;  // service requests for deduplication and global scheduler recovery
+    deque<pair<AppId, uint64_t>> srvReqOrder_;      // {appId, serial} in insertion order, for eviction
+    uint64_t srvReqSerial_ = 0;
+    map<int, int> neighborSlot_;    // neighbor address -> bit in SrvReqEntry::sentMask
+
+    map<uint32_t, vector<Ptr<VecRequest>>> pendingDigest_;  // destination address -> requests waiting for digestTimer_
+    cMessage *digestTimer_ = nullptr;
 
   protected:
 
@@ -51,7 +71,14 @@ class NodePacketController : public omnetpp::cSimpleModule
     virtual void handleMessage(omnetpp::cMessage *msg) override;
 
     virtual void handleServiceRequest(inet::Packet *packet);
+    virtual void handleServiceRequest(Ptr<VecRequest> srvReq, uint32_t senderAddr);
+    virtual SrvReqEntry& cacheServiceRequest(Ptr<VecRequest> srvReq);
+    virtual void disseminateServiceRequest(SrvReqEntry& entry);
+    virtual void sendServiceRequest(uint32_t destAddr, Ptr<VecRequest> srvReq);
+    virtual void sendServiceRequestDigests();
+    virtual int getNeighborSlot(int neighborAddr);
     virtual void handleServiceGrant(inet::Packet *packet);
+    virtual void handleServiceGrantBatch(inet::Packet *packet);
     virtual void handleServiceFeedback(inet::Packet *packet);
     virtual void handleOffloadingNicGrant(inet::Packet *packet);
 
@@ -18,6 +18,7 @@
 
 
 #include "mecrt/mobility/MecMobility.h"
+#include "mecrt/common/Database.h"
 
 #include <fstream>
 #include <iostream>
@@ -37,6 +38,9 @@ MecMobility::MecMobility()
     nextChange_ = -1;
     faceForward_ = false;
     enableInitDebug_ = false;
+    lazyMobility_ = false;
+    segmentIndex_ = 0;
+    lastLazyUpdate_ = -1;
 }
 
 MecMobility::~MecMobility()
@@ -91,6 +95,7 @@ void MecMobility::initialize(int stage)
         moveTimer_ = new cMessage("move");
         updateInterval_ = par("updateInterval");
         faceForward_ = par("faceForward");
+        lazyMobility_ = par("lazyMobility");
 
         maxSpeed_ = par("maxSpeed");
         targetPointIndex_ = 0;
@@ -105,9 +110,26 @@ void MecMobility::initialize(int stage)
 
         vehIndex_ = getParentModule()->getIndex();
         std::string vehTraceFolder = getAncestorPar("vehicleTraceFolder").stringValue();
-        std::string filePath = vehTraceFolder + "/" + std::to_string(vehIndex_) + ".txt";
-        EV << "MecMobility::initialize - reading waypoints from file: " << filePath << endl;
-        readWaypointsFromFile(filePath.c_str());
+        std::string binaryPath = par("binaryTraceFile").stdstringValue();
+
+        // the binary trace is only used when named explicitly, so a stale packed file never overrides the text traces
+        if (!binaryPath.empty())
+        {
+            // the binary trace holds the raw coordinates, it cannot be used with geographic conversion
+            if (findModuleFromPar<IGeographicCoordinateSystem>(par("coordinateSystemModule"), this) != nullptr)
+                throw cRuntimeError("MecMobility::initialize - binary trace '%s' cannot be used with a geographic coordinate system", binaryPath.c_str());
+            if (!VehicleTraceStore::exists(binaryPath))
+                throw cRuntimeError("MecMobility::initialize - binary trace file '%s' does not exist", binaryPath.c_str());
+
+            EV << "MecMobility::initialize - reading waypoints from binary trace: " << binaryPath << endl;
+            readWaypointsFromBinary(binaryPath.c_str());
+        }
+        else
+        {
+            std::string filePath = vehTraceFolder + "/" + std::to_string(vehIndex_) + ".txt";
+            EV << "MecMobility::initialize - reading waypoints from file: " << filePath << endl;
+            readWaypointsFromFile(filePath.c_str());
+        }
 
         initializeOrientation();
         initializePosition();
@@ -126,6 +148,11 @@ void MecMobility::initialize(int stage)
         showVehicle_ = new cMessage("showVehicle");
         scheduleAt(moveStartTime_, showVehicle_);
 
+        // the database deletes the vehicle after its trace ends, if enabled
+        Database* database = dynamic_cast<Database*>(getSimulation()->findModuleByPath("database"));
+        if (database != nullptr)
+            database->scheduleVehicleRetire(getParentModule(), moveStoptime_);
+
         if (enableInitDebug_)
             std::cout << "MecMobility::initialize - stage: INITSTAGE_LAST - ends" << std::endl;
     }
@@ -215,17 +242,34 @@ void MecMobility::readWaypointsFromFile(const char *fileName)
                 yPosition = sceneCoordinate.y;
                 timestamp = sceneCoordinate.z;
             }
-            waypoints_.push_back(Waypoint(xPosition, yPosition, timestamp));
+            waypointStore_.push_back(Waypoint(xPosition, yPosition, timestamp));
         }
         else
             break;
     }
+    waypoints_.data = waypointStore_.data();
+    waypoints_.count = waypointStore_.size();
 
     moveStartTime_ = startTime;
     moveStoptime_ = stopTime;
     EV << "MecMobility::readWaypointsFromFile - moveStartTime: " << moveStartTime_ << ", moveStoptime: " << moveStoptime_ << endl;
 }
 
+void MecMobility::readWaypointsFromBinary(const char *fileName)
+{
+    VehicleTraceStore* store = VehicleTraceStore::getStore(fileName);
+
+    double startTime = 0;
+    double stopTime = 0;
+    waypoints_.data = store->getTrace(vehIndex_, waypoints_.count, startTime, stopTime);
+    if (waypoints_.empty())
+        throw cRuntimeError("MecMobility::readWaypointsFromBinary - no waypoint for vehicle %d in '%s'", vehIndex_, fileName);
+
+    moveStartTime_ = startTime;
+    moveStoptime_ = stopTime;
+    EV << "MecMobility::readWaypointsFromBinary - moveStartTime: " << moveStartTime_ << ", moveStoptime: " << moveStoptime_ << endl;
+}
+
 void MecMobility::handleSelfMessage(cMessage *message)
 {
     EV << "MecMobility::handleSelfMessage - vehicle " << vehIndex_ << " self message " << message->getName() << " received" << endl;
@@ -239,7 +283,14 @@ void MecMobility::handleSelfMessage(cMessage *message)
         return;
     }
 
-    if (simTime() < moveStoptime_)
+    if (lazyMobility_ && simTime() < moveStoptime_)
+    {
+        updateLazyState();
+        emitMobilityStateChangedSignal();
+
+        scheduleLazyUpdate();
+    }
+    else if (simTime() < moveStoptime_)
     {
         bool arriveTarget = (nextChange_ <= simTime());
         move(arriveTarget);
@@ -250,7 +301,7 @@ void MecMobility::handleSelfMessage(cMessage *message)
     }
     else
     {
-        Waypoint lastPoint = waypoints_[targetPointIndex_];
+        Waypoint lastPoint = lazyMobility_ ? waypoints_.back() : waypoints_[targetPointIndex_];
         lastPosition = Coord(lastPoint.x, lastPoint.y);
         lastVelocity_ = Coord::ZERO;
         lastAngularVelocity_ = Quaternion::IDENTITY;
@@ -262,6 +313,13 @@ void MecMobility::handleSelfMessage(cMessage *message)
 
 void MecMobility::scheduleUpdate()
 {
+    if (lazyMobility_)
+    {
+        updateLazyState();
+        scheduleLazyUpdate();
+        return;
+    }
+
     // cancelEvent(moveTimer_);
     if (!stationary_ && updateInterval_ != 0) {
         // periodic update is needed
@@ -278,6 +336,74 @@ void MecMobility::scheduleUpdate()
         scheduleAt(nextChange_, moveTimer_);
 }
 
+void MecMobility::scheduleLazyUpdate()
+{
+    // the end of the current segment, where the velocity changes
+    simtime_t nextBoundary = moveStoptime_;
+    if (segmentIndex_ + 1 < waypoints_.size() && waypoints_[segmentIndex_ + 1].timestamp > simTime().dbl())
+        nextBoundary = std::min(nextBoundary, simtime_t(waypoints_[segmentIndex_ + 1].timestamp));
+
+    // the PHY pulls the position when it needs it (UePhy::getCurrentCoord), so the signal is only
+    // emitted where the velocity changes, the periodic update is only kept for the animation
+    simtime_t nextEvent = nextBoundary;
+    if (hasGUI() && updateInterval_ != 0)
+        nextEvent = std::min(nextBoundary, simTime() + updateInterval_);
+
+    nextChange_ = nextBoundary;
+    scheduleAt(std::max(nextEvent, simTime()), moveTimer_);
+}
+
+void MecMobility::updateLazyState()
+{
+    simtime_t now = simTime();
+    if (now == lastLazyUpdate_ || waypoints_.empty())
+        return;
+    lastLazyUpdate_ = now;
+
+    double t = now.dbl();
+    size_t lastSegment = segmentIndex_;
+
+    if (waypoints_.size() < 2 || now >= moveStoptime_)
+    {
+        const Waypoint& lastPoint = waypoints_.back();
+        lastPosition = Coord(lastPoint.x, lastPoint.y);
+        lastVelocity_ = Coord::ZERO;
+        segmentIndex_ = waypoints_.size() - 1;
+    }
+    else
+    {
+        // the time only moves forward, so the cursor is advanced from the cached segment
+        while (segmentIndex_ + 2 < waypoints_.size() && waypoints_[segmentIndex_ + 1].timestamp <= t)
+            segmentIndex_++;
+
+        const Waypoint& currPosi = waypoints_[segmentIndex_];
+        const Waypoint& nextPosi = waypoints_[segmentIndex_ + 1];
+        double dt = nextPosi.timestamp - currPosi.timestamp;
+        double ratio = (dt > 0) ? (t - currPosi.timestamp) / dt : 1;
+        ratio = std::min(1.0, std::max(0.0, ratio));
+
+        lastPosition = Coord(currPosi.x + (nextPosi.x - currPosi.x) * ratio, currPosi.y + (nextPosi.y - currPosi.y) * ratio);
+        if (dt > 0)
+        {
+            lastVelocity_.x = (nextPosi.x - currPosi.x) / dt * updateInterval_.dbl();   // increment x for every updateInterval_
+            lastVelocity_.y = (nextPosi.y - currPosi.y) / dt * updateInterval_.dbl();   // increment y for every updateInterval_
+        }
+        else
+            lastVelocity_ = Coord::ZERO;
+    }
+
+    if (ground_) {
+        lastPosition = ground_->computeGroundProjection(lastPosition);
+        lastVelocity_ = ground_->computeGroundProjection(lastPosition + lastVelocity_) - lastPosition;
+    }
+
+    // the orientation only changes with the segment (or the ground)
+    orient(segmentIndex_ != lastSegment);
+
+    EV << "MecMobility::updateLazyState - vehicle " << vehIndex_ << " segment " << segmentIndex_ << " position: x="
+        << lastPosition.x << ", y=" << lastPosition.y << endl;
+}
+
 void MecMobility::move(bool arriveTarget)
 {
     // if reached the target point, change to the next one
@@ -367,16 +493,22 @@ void MecMobility::orient(bool arriveTarget)
 
 const Coord& MecMobility::getCurrentPosition()
 {
+    if (lazyMobility_)
+        updateLazyState();
     return lastPosition;
 }
 
 const Coord& MecMobility::getCurrentVelocity()
 {
+    if (lazyMobility_)
+        updateLazyState();
     return lastVelocity_;
 }
 
 const Quaternion& MecMobility::getCurrentAngularPosition()
 {
+    if (lazyMobility_)
+        updateLazyState();
     return lastOrientation;
 }
 
@@ -23,6 +23,8 @@
 #include "inet/environment/contract/IGround.h"
 #include "inet/mobility/base/MobilityBase.h"
 
+#include "mecrt/mobility/VehicleTraceStore.h"
+
 using namespace inet;
 using namespace physicalenvironment;
 
@@ -34,12 +36,20 @@ using namespace physicalenvironment;
 class MecMobility : public MobilityBase
 {
   protected:
-    struct Waypoint {
-        double x;
-        double y;
-        double timestamp;
+    typedef VehicleTracePoint Waypoint;
 
-        Waypoint(double x, double y, double timestamp) : x(x), y(y), timestamp(timestamp) {}
+    /***
+     * read-only view of the waypoints, either parsed from the text trace into waypointStore_
+     * or pointing into the shared binary trace file
+     */
+    struct WaypointView {
+        const Waypoint* data = nullptr;
+        size_t count = 0;
+
+        const Waypoint& operator[](size_t i) const { return data[i]; }
+        const Waypoint& back() const { return data[count - 1]; }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
     };
 
   protected:
@@ -54,7 +64,8 @@ class MecMobility : public MobilityBase
     cMessage *showVehicle_;	// the message to show the vehicle
 
     // configuration
-    std::vector<Waypoint> waypoints_;
+    WaypointView waypoints_;
+    std::vector<Waypoint> waypointStore_;   // waypoints read from a text trace
 
     // The ground module given by the "groundModule" parameter, pointer stored for easier access.
     physicalenvironment::IGround *ground_ = nullptr;
@@ -92,6 +103,15 @@ class MecMobility : public MobilityBase
 
     bool faceForward_;
 
+    /***
+     * lazy mobility: the position is interpolated on the waypoint segment at the time it is queried,
+     * mobilityStateChanged is only emitted at waypoint boundaries (and every updateInterval_ when a GUI
+     * is shown), the consumers (UePhy, MecChannelModel) pull the position with getCurrentPosition()
+     */
+    bool lazyMobility_;
+    size_t segmentIndex_;         // cursor of the current waypoint segment [segmentIndex_, segmentIndex_ + 1]
+    simtime_t lastLazyUpdate_;    // the time the lazy state was last computed
+
   protected:
 
     virtual void initialize(int stage) override;
@@ -112,15 +132,25 @@ class MecMobility : public MobilityBase
 
     virtual void orient(bool arriveTarget);	
 
+    /** @brief Interpolates the position and velocity on the waypoint segment at the current simulation time. */
+    virtual void updateLazyState();
+
+    /** @brief Schedules the move timer in lazy mode. */
+    void scheduleLazyUpdate();
+
     virtual void setInitialPosition() override;
 
     virtual void readWaypointsFromFile(const char *fileName);
 
+    /** @brief Reads the waypoints of this vehicle from the packed binary trace file (no copy). */
+    virtual void readWaypointsFromBinary(const char *fileName);
+
   public:
     MecMobility();
     virtual ~MecMobility();
 
     virtual double getMaxSpeed() const override { return maxSpeed_; }
+    virtual bool isLazyMobility() const { return lazyMobility_; }
 
 	  virtual const Coord& getCurrentPosition() override;
     virtual const Coord& getCurrentVelocity() override;
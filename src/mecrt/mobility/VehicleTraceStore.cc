@@ -0,0 +1,133 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    VehicleTraceStore.cc / VehicleTraceStore.h
+//
+//  Description:
+//    This file implements the read-only store of the packed binary vehicle traces.
+//    The binary file is generated once from the per-vehicle text traces (see
+//    simulations/distributed/traceConvert.py) and memory mapped, so all the vehicles
+//    of a simulation (and all simulations using the same map) share the same pages.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#include "mecrt/mobility/VehicleTraceStore.h"
+
+#include <cstring>
+#include <fstream>
+#include <omnetpp.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace omnetpp;
+
+static const char VEHICLE_TRACE_MAGIC[8] = "MECTRC1";
+static const size_t VEHICLE_TRACE_HEADER_SIZE = 16;
+
+static_assert(sizeof(VehicleTracePoint) == 3 * sizeof(double), "VehicleTracePoint must match the binary record layout");
+
+std::map<std::string, std::unique_ptr<VehicleTraceStore>> VehicleTraceStore::stores_;
+
+VehicleTraceStore* VehicleTraceStore::getStore(const std::string& fileName)
+{
+    auto it = stores_.find(fileName);
+    if (it != stores_.end())
+        return it->second.get();
+
+    VehicleTraceStore* store = new VehicleTraceStore(fileName);
+    stores_[fileName].reset(store);
+    return store;
+}
+
+bool VehicleTraceStore::exists(const std::string& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    return file.good();
+}
+
+VehicleTraceStore::VehicleTraceStore(const std::string& fileName)
+{
+    fileName_ = fileName;
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+
+#ifndef _WIN32
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw cRuntimeError("VehicleTraceStore - cannot open binary trace file '%s'", fileName.c_str());
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr != MAP_FAILED)
+        {
+            data_ = static_cast<const char*>(addr);
+            size_ = st.st_size;
+            mapped_ = true;
+        }
+    }
+    close(fd);
+#endif
+
+    if (!mapped_)
+    {
+        // fall back to reading the whole file
+        std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            throw cRuntimeError("VehicleTraceStore - cannot open binary trace file '%s'", fileName.c_str());
+        buffer_.resize(file.tellg());
+        file.seekg(0);
+        file.read(buffer_.data(), buffer_.size());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+    }
+
+    if (size_ < VEHICLE_TRACE_HEADER_SIZE || memcmp(data_, VEHICLE_TRACE_MAGIC, sizeof(VEHICLE_TRACE_MAGIC)) != 0)
+        throw cRuntimeError("VehicleTraceStore - '%s' is not a binary vehicle trace file", fileName.c_str());
+
+    memcpy(&numVehicles_, data_ + 8, sizeof(numVehicles_));
+
+    size_t tableSize = (size_t)numVehicles_ * sizeof(VehicleEntry);
+    if (size_ < VEHICLE_TRACE_HEADER_SIZE + tableSize)
+        throw cRuntimeError("VehicleTraceStore - truncated vehicle table in '%s'", fileName.c_str());
+
+    vehicles_ = reinterpret_cast<const VehicleEntry*>(data_ + VEHICLE_TRACE_HEADER_SIZE);
+    points_ = reinterpret_cast<const VehicleTracePoint*>(data_ + VEHICLE_TRACE_HEADER_SIZE + tableSize);
+    numPoints_ = (size_ - VEHICLE_TRACE_HEADER_SIZE - tableSize) / sizeof(VehicleTracePoint);
+
+    EV << "VehicleTraceStore - " << fileName_ << " holds " << numVehicles_ << " vehicles and " << numPoints_ << " points"
+       << (mapped_ ? " (memory mapped)" : "") << endl;
+}
+
+VehicleTraceStore::~VehicleTraceStore()
+{
+#ifndef _WIN32
+    if (mapped_)
+        munmap(const_cast<char*>(data_), size_);
+#endif
+}
+
+const VehicleTracePoint* VehicleTraceStore::getTrace(int vehIndex, size_t& count, double& startTime, double& stopTime) const
+{
+    if (vehIndex < 0 || (uint32_t)vehIndex >= numVehicles_)
+        throw cRuntimeError("VehicleTraceStore::getTrace - vehicle %d is not in '%s' (%u vehicles)", vehIndex, fileName_.c_str(), numVehicles_);
+
+    const VehicleEntry& entry = vehicles_[vehIndex];
+    if (entry.first + entry.count > numPoints_)
+        throw cRuntimeError("VehicleTraceStore::getTrace - the trace of vehicle %d exceeds '%s'", vehIndex, fileName_.c_str());
+
+    count = entry.count;
+    startTime = entry.startTime;
+    stopTime = entry.stopTime;
+    return points_ + entry.first;
+}
@@ -0,0 +1,92 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    VehicleTraceStore.cc / VehicleTraceStore.h
+//
+//  Description:
+//    This file implements the read-only store of the packed binary vehicle traces.
+//    The binary file is generated once from the per-vehicle text traces (see
+//    simulations/distributed/traceConvert.py) and memory mapped, so all the vehicles
+//    of a simulation (and all simulations using the same map) share the same pages.
+//
+//    File layout (native byte order):
+//      char     magic[8]            "MECTRC1"
+//      uint32_t numVehicles
+//      uint32_t reserved
+//      numVehicles x { uint64_t first, uint64_t count, double startTime, double stopTime }
+//      all points  x { double x, double y, double timestamp }
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#ifndef __MECRT_VEHICLETRACESTORE_H
+#define __MECRT_VEHICLETRACESTORE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/***
+ * one point of a vehicle trace, the layout is the record layout of the binary file
+ */
+struct VehicleTracePoint
+{
+    double x;
+    double y;
+    double timestamp;
+
+    VehicleTracePoint() = default;
+    VehicleTracePoint(double x, double y, double timestamp) : x(x), y(y), timestamp(timestamp) {}
+};
+
+class VehicleTraceStore
+{
+  protected:
+    struct VehicleEntry
+    {
+        uint64_t first;
+        uint64_t count;
+        double startTime;
+        double stopTime;
+    };
+
+    std::string fileName_;
+    const char* data_;          // the mapped (or loaded) file
+    size_t size_;
+    std::vector<char> buffer_;  // holds the file when it cannot be memory mapped
+    bool mapped_;
+
+    uint32_t numVehicles_;
+    const VehicleEntry* vehicles_;
+    const VehicleTracePoint* points_;
+    uint64_t numPoints_;
+
+    // stores opened in this process, {fileName: store}
+    static std::map<std::string, std::unique_ptr<VehicleTraceStore>> stores_;
+
+    VehicleTraceStore(const std::string& fileName);
+
+  public:
+    ~VehicleTraceStore();
+
+    /***
+     * get the store of the given binary trace file, the file is opened and mapped on the first call
+     */
+    static VehicleTraceStore* getStore(const std::string& fileName);
+
+    // whether the file exists and can be read
+    static bool exists(const std::string& fileName);
+
+    uint32_t getNumVehicles() const { return numVehicles_; }
+
+    /***
+     * get the trace of a vehicle, the points stay valid as long as the process runs
+     */
+    const VehicleTracePoint* getTrace(int vehIndex, size_t& count, double& startTime, double& stopTime) const;
+};
+
+#endif
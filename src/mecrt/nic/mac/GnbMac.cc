@@ -75,6 +75,12 @@ GnbMac::~GnbMac()
         cancelAndDelete(flushAppPduList_);
         flushAppPduList_ = nullptr;
     }
+    // remove rsuFdBatchTimer_ message
+    if (rsuFdBatchTimer_)
+    {
+        cancelAndDelete(rsuFdBatchTimer_);
+        rsuFdBatchTimer_ = nullptr;
+    }
     // remove ttiTick_ message
     if (ttiTick_)
     {
@@ -131,6 +137,7 @@ void GnbMac::initialize(int stage)
 
         srsDistanceCheck_ = par("srsDistanceCheck");  // whether checking the distance for SRS transmission, default(false)
         srsDistance_ = par("srsDistance");  // the distance for SRS transmission
+        rsuFdBatchWindow_ = par("rsuFeedbackBatchWindow");  // default(0s), no batching
 
         /* Set The MAC MIB */
 
@@ -426,6 +433,8 @@ void GnbMac::initialize(int stage)
         flushAppPduList_ = new cMessage("flushAppPduList");
         flushAppPduList_->setSchedulingPriority(1);        // after other messages
 
+        rsuFdBatchTimer_ = new cMessage("rsuFdBatchTimer");
+
         if (enableInitDebug_)
             std::cout << "GnbMac::initialize - stage: INITSTAGE_LAST - ends" << std::endl;
     }
@@ -460,6 +469,10 @@ void GnbMac::handleMessage(cMessage* msg)
         {
             flushAppPduList();
         }
+        else if (strcmp(msg->getName(), "rsuFdBatchTimer") == 0)
+        {
+            mecSendRsuFeedbackBatch();
+        }
         else
         {
             // if (!resAllocateMode_)
@@ -474,6 +487,9 @@ void GnbMac::handleMessage(cMessage* msg)
             // }
             // scheduleAt(NOW + ttiPeriod_, ttiTick_);
 
+            // the TTI tick is event driven: it is only scheduled by scheduleTtiTick() when there is
+            // pending work (i.e., grants from the RSU server) and is not rescheduled once the work is done,
+            // so idle gNBs generate no per-TTI events
             // new grant from rsu server
             while (!grantList_.empty())
             {
@@ -518,6 +534,22 @@ void GnbMac::handleMessage(cMessage* msg)
     }
 }
 
+void GnbMac::scheduleTtiTick()
+{
+    if (ttiTick_ == nullptr || ttiTick_->isScheduled())
+        return;
+
+    // align the tick to the next TTI boundary (or the current one if NOW is on a boundary).
+    // integer arithmetic on the raw simtime avoids ceil() on doubles pushing the tick one TTI late
+    int64_t periodRaw = SimTime(ttiPeriod_).raw();
+    int64_t nextRaw = ((NOW.raw() + periodRaw - 1) / periodRaw) * periodRaw;
+    SimTime nextTti;
+    nextTti.setRaw(nextRaw);
+
+    EV << "GnbMac::scheduleTtiTick - wake up MAC at " << nextTti << endl;
+    scheduleAt(nextTti, ttiTick_);
+}
+
 void GnbMac::handleSelfMessage()
 {
     /***************
@@ -1058,11 +1090,12 @@ void GnbMac::mecFeedbackRsuStatus(double carrierFreq, MacNodeId ueId, bool isBro
     {
         EV << "GnbMac::mecFeedbackRsuStatus - broadcast feedback from vehicle " << ueId << endl;
 
-        // first check all active apps
-        set<AppId> activeSrv = rbManagerUl_->getScheduledApp();
-        for (AppId appId : activeSrv)
+        // first check all active apps of this vehicle
+        // copy the (small) per-UE app list, as terminateService() removes entries from it
+        vector<AppId> ueApps(rbManagerUl_->getUeApps(ueId).begin(), rbManagerUl_->getUeApps(ueId).end());
+        for (AppId appId : ueApps)
         {
-            if (MacCidToNodeId(appId) == ueId)
+            if (rbManagerUl_->isScheduledApp(appId))
             {
                 int oldBands = rbManagerUl_->getAppAllocatedBands(appId);
                 bool result = rbManagerUl_->scheduleActiveApp(appId);
@@ -1086,25 +1119,35 @@ void GnbMac::mecFeedbackRsuStatus(double carrierFreq, MacNodeId ueId, bool isBro
         }
 
         // stop all apps in appToBeInitialized_ (have not been initialized yet)
-        set<AppId> appToBeInitialized = rbManagerUl_->getAppToBeInitialized();
-        for (AppId appId : appToBeInitialized)
+        // terminateService() removes the app from the set, so always take the first one
+        const set<AppId>& appToBeInitialized = rbManagerUl_->getAppToBeInitialized();
+        while (!appToBeInitialized.empty())
         {
+            AppId appId = *appToBeInitialized.begin();
             EV << "GnbMac::mecFeedbackRsuStatus - broadcast feedback, app " << appId 
                 << " has not been initialized, terminate it." << endl;
             terminateService(appId);
         }
 
         // stop all paused apps
-        set<AppId> pausedApps = rbManagerUl_->getPausedApp();
-        for (AppId appId : pausedApps)
+        const set<AppId>& pausedApps = rbManagerUl_->getPausedApp();
+        while (!pausedApps.empty())
         {
+            AppId appId = *pausedApps.begin();
             EV << "GnbMac::mecFeedbackRsuStatus - broadcast feedback, paused app " << appId 
                 << " is terminated." << endl;
             terminateService(appId);
         }
 
         // if the data rate is not 0, update the latest data rate to the scheduler
-        if (bytePerBand > 0 && !nodeInfo_->getGlobalSchedulerAddr().isUnspecified())
+        if (bytePerBand > 0 && !nodeInfo_->getGlobalSchedulerAddr().isUnspecified() && rsuFdBatchWindow_ > 0)
+        {
+            // UEs broadcast their feedback at almost the same time, collect them and send in one packet
+            pendingRateUpdates_[ueId] = simTime();
+            if (!rsuFdBatchTimer_->isScheduled())
+                scheduleAt(simTime() + rsuFdBatchWindow_, rsuFdBatchTimer_);
+        }
+        else if (bytePerBand > 0 && !nodeInfo_->getGlobalSchedulerAddr().isUnspecified())
         {
             Packet* packet = new Packet("RsuFD");
             auto rsuFd = makeShared<RsuFeedback>();
@@ -1127,13 +1170,14 @@ void GnbMac::mecFeedbackRsuStatus(double carrierFreq, MacNodeId ueId, bool isBro
     }
 
     /**
-     * check the influence to the scheduled apps
+     * check the influence to the scheduled apps of this vehicle
+     * the apps of a vehicle are not removed from the per-UE index in this branch
      */
-    set<AppId> activeSrv = rbManagerUl_->getScheduledApp();
+    const set<AppId>& ueApps = rbManagerUl_->getUeApps(ueId);
     set<AppId> active2PausedSrv;
-    for (AppId appId : activeSrv)
+    for (AppId appId : ueApps)
     {
-        if (MacCidToNodeId(appId) == ueId)
+        if (rbManagerUl_->isScheduledApp(appId))
         {
             int oldBands = rbManagerUl_->getAppAllocatedBands(appId);
             bool result = rbManagerUl_->scheduleActiveApp(appId);
@@ -1157,10 +1201,9 @@ void GnbMac::mecFeedbackRsuStatus(double carrierFreq, MacNodeId ueId, bool isBro
     /***
      * check apps in appToBeInitialized_
      */
-    set<AppId> appToBeInitialized = rbManagerUl_->getAppToBeInitialized();
-    for (AppId appId : appToBeInitialized)
+    for (AppId appId : ueApps)
     {
-        if (MacCidToNodeId(appId) == ueId)
+        if (rbManagerUl_->isAppToBeInitialized(appId))
         {
             bool result = rbManagerUl_->scheduleGrantedApp(appId);
             if (result)    // the granted bands are enough for the app
@@ -1188,9 +1231,11 @@ void GnbMac::mecFeedbackRsuStatus(double carrierFreq, MacNodeId ueId, bool isBro
         }
     }
     // check other paused apps
-    set<AppId> pausedApps = rbManagerUl_->getPausedApp();
-    for (AppId appId : pausedApps)
+    // schedulePausedApp() only removes the current app from the set, so advance the iterator first
+    const set<AppId>& pausedApps = rbManagerUl_->getPausedApp();
+    for (auto it = pausedApps.begin(); it != pausedApps.end(); )
     {
+        AppId appId = *it++;
         // next schedule apps other than the active2PausedSrv
         if (active2PausedSrv.find(appId) == active2PausedSrv.end())
         {
@@ -1270,11 +1315,11 @@ void GnbMac::mecTerminateAllGrant()
     appPduList_.clear();
     
     set<AppId> allApps;
-    set<AppId> activeSrv = rbManagerUl_->getScheduledApp();
+    const set<AppId>& activeSrv = rbManagerUl_->getScheduledApp();
     allApps.insert(activeSrv.begin(), activeSrv.end());
-    set<AppId> appToBeInitialized = rbManagerUl_->getAppToBeInitialized();
+    const set<AppId>& appToBeInitialized = rbManagerUl_->getAppToBeInitialized();
     allApps.insert(appToBeInitialized.begin(), appToBeInitialized.end());
-    set<AppId> pausedApps = rbManagerUl_->getPausedApp();
+    const set<AppId>& pausedApps = rbManagerUl_->getPausedApp();
     allApps.insert(pausedApps.begin(), pausedApps.end());
 
     for (AppId appId : allApps)
@@ -1287,6 +1332,54 @@ void GnbMac::mecTerminateAllGrant()
 }
 
 
+void GnbMac::mecSendRsuFeedbackBatch()
+{
+    if (pendingRateUpdates_.empty() || nodeInfo_->getGlobalSchedulerAddr().isUnspecified())
+    {
+        pendingRateUpdates_.clear();
+        return;
+    }
+
+    auto rsuFdBatch = makeShared<RsuFeedbackBatch>();
+    rsuFdBatch->setGnbId(nodeId_);
+    rsuFdBatch->setServerPort(serverPort_);
+    rsuFdBatch->setFrequency(rbManagerUl_->getFrequency());
+    rsuFdBatch->setAvailBands(rbManagerUl_->getAvailableBands());
+    rsuFdBatch->setTotalBands(rbManagerUl_->getNumBands());
+    rsuFdBatch->setRsuAddr(nodeInfo_->getNodeAddr().getInt());
+    rsuFdBatch->setBandUpdateTime(simTime());
+
+    // the data rate may have been changed by a later feedback, always report the latest one
+    rsuFdBatch->setVehIdArraySize(pendingRateUpdates_.size());
+    rsuFdBatch->setBytePerBandArraySize(pendingRateUpdates_.size());
+    rsuFdBatch->setRateUpdateTimeArraySize(pendingRateUpdates_.size());
+    size_t numVehs = 0;
+    for (const auto& pair : pendingRateUpdates_)
+    {
+        int bytePerBand = rbManagerUl_->getVehDataRate(pair.first);
+        if (bytePerBand <= 0)
+            continue;
+
+        rsuFdBatch->setVehId(numVehs, pair.first);
+        rsuFdBatch->setBytePerBand(numVehs, bytePerBand);
+        rsuFdBatch->setRateUpdateTime(numVehs, pair.second);
+        numVehs++;
+    }
+    pendingRateUpdates_.clear();
+
+    rsuFdBatch->setVehIdArraySize(numVehs);
+    rsuFdBatch->setBytePerBandArraySize(numVehs);
+    rsuFdBatch->setRateUpdateTimeArraySize(numVehs);
+    rsuFdBatch->setChunkLength(B(56 + 16 * (int)numVehs));
+    rsuFdBatch->addTag<CreationTimeTag>()->setCreationTime(simTime());
+
+    EV << "GnbMac::mecSendRsuFeedbackBatch - send the data rates of " << numVehs << " vehicles to the scheduler" << endl;
+    Packet* packet = new Packet("RsuFDBatch");
+    packet->insertAtBack(rsuFdBatch);
+    mecSendDataToAppLayer(packet, serverPort_, gnbAddress_);
+}
+
+
 void GnbMac::mecRecoverRsuStatus()
 {
     // this function is called by other modules (the nodeInfo_), so we need to use
@@ -1342,12 +1435,7 @@ void GnbMac::handleUpperMessage(cPacket* pktAux)
     if (!strcmp(pktAux->getName(), "NicGrant"))
     {
         grantList_.push_back(pktAux);
-
-        if (!ttiTick_->isScheduled())
-        {
-            int timeInt = ceil(NOW.dbl() / ttiPeriod_);
-            scheduleAt(timeInt * ttiPeriod_, ttiTick_);
-        }
+        scheduleTtiTick();
         return;
     }
 
@@ -1496,7 +1584,7 @@ void GnbMac::mecSendGrantToVeh(AppId appId, bool isNewGrant, bool isUpdate, bool
     if (isNewGrant || isUpdate)
     {
         int bytePerTTI = rbManagerUl_->getVehDataRate(ueId);
-        int grantedBands = srv.grantedBandSet.size() + srv.tempBands.size();
+        int grantedBands = rbManagerUl_->getAppAllocatedBands(appId);
         grant->setBytePerTTI(bytePerTTI * grantedBands);
 
         std::map<Band, unsigned int> rbMap;
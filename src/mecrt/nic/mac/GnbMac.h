@@ -72,11 +72,48 @@ class GnbMac : public NRMacGnb
     /***
      * set the allowed bands for each UE, this should be set by the global scheduler.
      */
-    virtual void setAllowedBandsUeUl(MacNodeId nodeId, std::set<Band> bands) { allowedBandsUeUl_[nodeId] = bands;}
+    virtual void setAllowedBandsUeUl(MacNodeId nodeId, std::set<Band> bands)
+    {
+        BandMask mask = 0;
+        for (Band b : bands)
+            mask |= bandToMask(b);
+        if (getAllowedBandMaskUeUl(nodeId) != mask)
+            amc_->invalidateTxParams(nodeId, UL);
+        allowedBandMaskUeUl_[nodeId] = mask;
+        allowedBandsUeUl_[nodeId] = bands;
+    }
     virtual void setAllowedBandsUeDl(MacNodeId nodeId, std::set<Band> bands) { allowedBandsUeDl_[nodeId] = bands;}
 
+    /***
+     * bitmask form of the allowed uplink bands, the band set is only rebuilt when the mask changes.
+     */
+    virtual BandMask getAllowedBandMaskUeUl(MacNodeId nodeId)
+    {
+        auto it = allowedBandMaskUeUl_.find(nodeId);
+        return (it == allowedBandMaskUeUl_.end()) ? 0 : it->second;
+    }
+    // returns whether the allowed bands of the UE have been changed
+    virtual bool setAllowedBandMaskUeUl(MacNodeId nodeId, BandMask mask)
+    {
+        auto it = allowedBandMaskUeUl_.find(nodeId);
+        if (it != allowedBandMaskUeUl_.end() && it->second == mask)
+            return false;
+
+        allowedBandMaskUeUl_[nodeId] = mask;
+        std::set<Band>& bands = allowedBandsUeUl_[nodeId];
+        bands.clear();
+        for (BandMask m = mask; m; m &= m - 1)
+            bands.insert(lowestBand(m));
+        // the cached UserTxParams were computed on the previous usable bands
+        amc_->invalidateTxParams(nodeId, UL);
+        return true;
+    }
+
     virtual void resetAllowedBandsUe()
     {
+        for (auto& ue : allowedBandMaskUeUl_)
+            amc_->invalidateTxParams(ue.first, UL);
+        allowedBandMaskUeUl_.clear();
         allowedBandsUeUl_.clear();
         allowedBandsUeDl_.clear();
     }
@@ -125,11 +162,16 @@ class GnbMac : public NRMacGnb
     bool srsDistanceCheck_;  // whether to check the distance for SRS transmission
     double srsDistance_;  // the effective distance for SRS transmission
 
+    omnetpp::simtime_t rsuFdBatchWindow_;  // window for batching the RSU status feedback, 0 to send one RsuFeedback per UE
+    omnetpp::cMessage * rsuFdBatchTimer_ = nullptr;  // send the RsuFeedbackBatch at the end of the window
+    std::map<MacNodeId, omnetpp::simtime_t> pendingRateUpdates_;  // UEs whose data rate is waiting for the RsuFeedbackBatch, with the update time
+
     /***
      * set of allowed bands for each ue, used for frequency division resource allocation
      */
     std::map<MacNodeId, std::set<Band>>   allowedBandsUeUl_;
     std::map<MacNodeId, std::set<Band>>   allowedBandsUeDl_;
+    std::map<MacNodeId, BandMask>   allowedBandMaskUeUl_;   // same as allowedBandsUeUl_, kept in sync
 
     unsigned int rbPerBand_;  // number of resource blocks per band
 
@@ -155,6 +197,11 @@ class GnbMac : public NRMacGnb
      */
     virtual void mecFeedbackRsuStatus(double carrierFreq, MacNodeId ueId, bool isBroadcast, double distance);
 
+    /***
+     * send the data rates collected in the batching window and the RSU status to RSU server in one packet
+     */
+    virtual void mecSendRsuFeedbackBatch();
+
 
     virtual void terminateService(AppId appId);
 
@@ -181,6 +228,12 @@ class GnbMac : public NRMacGnb
     // send the received data to the upper layer
     virtual void flushAppPduList();
 
+    /***
+     * wake up the MAC main loop at the next TTI boundary if it is sleeping
+     * the gNB MAC does not tick while idle, see handleMessage()
+     */
+    virtual void scheduleTtiTick();
+
 
     /**
      * Getter for AMC module
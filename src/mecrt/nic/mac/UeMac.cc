@@ -19,6 +19,7 @@
 #include "mecrt/packets/apps/VecPacket_m.h"
 #include "mecrt/packets/nic/VecDataInfo_m.h"
 #include "mecrt/nic/phy/UePhy.h"
+#include "mecrt/nic/mac/amc/MecNRAmc.h"
 
 #include "inet/common/TimeTag_m.h"
 #include "inet/networklayer/common/NetworkInterface.h"
@@ -214,6 +215,7 @@ void UeMac::initialize(int stage)
         nodeInfo_->setNodeId(nodeId_);
 
         resAllocateMode_ = par("resAllocateMode");
+        flowLevelOffload_ = par("flowLevelOffload");
 
         /***
          * the "nrMasterId" refers to the macNodeId of the gNB that this UE linked to.
@@ -412,6 +414,50 @@ void UeMac::attachToGnb(MacNodeId gnbId)
 }
 
 
+void UeMac::detachFromGnb(MacNodeId gnbId)
+{
+    if (gnbId > 0)
+    {
+        LteAmc *amc = check_and_cast<LteMacEnb *>(getMacByMacNodeId(gnbId))->getAmc();
+        // MecNRAmc also drops the CQI summaries of this UE
+        MecNRAmc *mecAmc = dynamic_cast<MecNRAmc *>(amc);
+        if (mecAmc != nullptr)
+        {
+            mecAmc->detachUser(nodeId_, UL);
+            mecAmc->detachUser(nodeId_, DL);
+            mecAmc->detachUser(nodeId_, D2D);
+            return;
+        }
+        amc->detachUser(nodeId_, UL);
+        amc->detachUser(nodeId_, DL);
+        amc->detachUser(nodeId_, D2D);
+    }
+}
+
+
+void UeMac::finish()
+{
+    NRMacUe::finish();
+
+    // do this only when the vehicle is deleted during the simulation
+    if (getSimulation()->getSimulationStage() == CTX_FINISH)
+        return;
+
+    EV << "UeMac::finish - UE [" << nodeId_ << "] leaves the simulation, detach from the gNBs" << endl;
+
+    // the serving cell is detached by the PHY layer (LtePhyUe::finish)
+    if (resAllocateMode_)
+    {
+        std::vector<EnbInfo *>* gnbList = binder_->getEnbList();
+        for (auto it = gnbList->begin(); it != gnbList->end(); ++it)
+        {
+            if ((*it)->id != cellId_)
+                detachFromGnb((*it)->id);
+        }
+    }
+}
+
+
 void UeMac::handleMessage(cMessage* msg)
 {
     if (msg->isSelfMessage())
@@ -698,6 +744,10 @@ void UeMac::vecHandleVehicularGrant(cPacket* pktAux)
         check_and_cast<UePhy*>(phy_)->addGrantedRsu(grant->getOffloadGnbId());
         Direction dir = static_cast<Direction>(userInfo->getDirection());
         EV << "\t New grant received! Byte rate per TTI: " << grant->getBytePerTTI() << ", Direction: " << dir << endl;
+
+        // data buffered before the grant arrived can be served now
+        if (hasGrantedData(appId))
+            scheduleTtiTick();
     }
     else if (grant->getGrantUpdate())   // check if it is a grant update
     {
@@ -710,6 +760,9 @@ void UeMac::vecHandleVehicularGrant(cPacket* pktAux)
 
         Direction dir = static_cast<Direction>(userInfo->getDirection());
         EV << "\t Grant update received! New byte rate per TTI: " << grant->getBytePerTTI() << ", Direction: " << dir << endl;
+
+        if (hasGrantedData(appId))
+            scheduleTtiTick();
     }
     else if (grant->getPause())
     {
@@ -1101,11 +1154,18 @@ void UeMac::vecHandleSelfMessage()
 
     if (requestedSdus_ > 0)
     {
-        // Message that triggers flushing of Tx H-ARQ buffers for all users
-        // This way, flushing is performed after the (possible) reception of new MAC PDUs
-        cMessage* flushAppMsg = new cMessage("flushAppMsg");
-        flushAppMsg->setSchedulingPriority(1);        // after other messages
-        scheduleAt(NOW, flushAppMsg);
+        /***
+         * in flow-level mode, the MAC PDU is sent down as soon as the last SDU arrives from RLC
+         * (see handleUpperMessage), so the flush event is not scheduled
+         */
+        if (!flowLevelOffload_)
+        {
+            // Message that triggers flushing of Tx H-ARQ buffers for all users
+            // This way, flushing is performed after the (possible) reception of new MAC PDUs
+            cMessage* flushAppMsg = new cMessage("flushAppMsg");
+            flushAppMsg->setSchedulingPriority(1);        // after other messages
+            scheduleAt(NOW, flushAppMsg);
+        }
 
         EV << NOW << " UeMac::vecHandleSelfMessage - UE [" << nodeId_ << "] - requested " << requestedSdus_ << " SDUs" << endl;
     }
@@ -1353,6 +1413,7 @@ void UeMac::handleUpperMessage(cPacket* pktAux)
     }
 
     bool isNotifyNewData = checkIfHeaderType<LteRlcPduNewData>(pkt);    // check if this is a notification for new arriving data
+    MacCid newDataCid = isNotifyNewData ? ctrlInfoToMacCid(pkt->getTag<FlowControlInfo>()) : 0;  // the notification is deleted once bufferized
     // bufferize packet
     bufferizePacket(pkt);
 
@@ -1367,6 +1428,10 @@ void UeMac::handleUpperMessage(cPacket* pktAux)
         if (requestedSdus_ == 0)
         {
             vecMacPduMake();
+
+            // flow-level mode: send the PDU down now instead of on the flushAppMsg event
+            if (flowLevelOffload_)
+                vecFlushAppPduList();
             
             // if (resAllocateMode_)
             // {
@@ -1385,14 +1450,36 @@ void UeMac::handleUpperMessage(cPacket* pktAux)
     }
     else    // is notify new data, start the tti tick
     {
-        if (ttiTick_ != nullptr && !ttiTick_->isScheduled())
-        {
-            int intTime = ceil(NOW.dbl() / ttiPeriod_);
-            scheduleAt(intTime * ttiPeriod_, ttiTick_);
-        }
+        // data of an app without grant stays buffered until the grant arrives (see vecHandleVehicularGrant)
+        if (hasGrantedData(newDataCid))
+            scheduleTtiTick();
     }
 }
 
+void UeMac::scheduleTtiTick()
+{
+    if (ttiTick_ == nullptr || ttiTick_->isScheduled())
+        return;
+
+    // align the tick to the next TTI boundary (or the current one if NOW is on a boundary)
+    int64_t periodRaw = SimTime(ttiPeriod_).raw();
+    int64_t nextRaw = ((NOW.raw() + periodRaw - 1) / periodRaw) * periodRaw;
+    SimTime nextTti;
+    nextTti.setRaw(nextRaw);
+
+    EV << "UeMac::scheduleTtiTick - wake up MAC at " << nextTti << endl;
+    scheduleAt(nextTti, ttiTick_);
+}
+
+bool UeMac::hasGrantedData(AppId appId)
+{
+    if (grantedApp_.find(appId) == grantedApp_.end())
+        return false;
+
+    auto it = macBuffers_.find(appId);
+    return it != macBuffers_.end() && !it->second->isEmpty();
+}
+
 
 bool UeMac::bufferizePacket(cPacket* pktAux)
 {
@@ -64,6 +64,7 @@ class UeMac : public NRMacUe
     std::map<AppId, inet::Packet *> appPduList_;
 
     bool resAllocateMode_;  // whether considering resource allocation mode
+    bool flowLevelOffload_; // whether the MAC PDU is sent down right after it is built, without the flush event
 
     MecMobility *mobility_;   // the mobility module of the vehicle
     simtime_t moveStartTime_;	// the start time of the provided file, start moving
@@ -89,11 +90,24 @@ class UeMac : public NRMacUe
     // flush the app pdu list
     virtual void vecFlushAppPduList();
 
+    /***
+     * the TTI tick is event driven: it is only scheduled when a granted app has buffered data,
+     * i.e., on new data from RLC or on the arrival of a grant for an app with buffered data.
+     * waiting UEs generate no per-TTI events
+     */
+    virtual void scheduleTtiTick();
+
+    // whether the app is granted and has data buffered in the MAC
+    virtual bool hasGrantedData(AppId appId);
+
     /***
      * attach the ue to the all gNBs in the simulation
      */
     virtual void attachToGnb(MacNodeId gnbId);
 
+    // reverse of attachToGnb()
+    virtual void detachFromGnb(MacNodeId gnbId);
+
     // ================================
     // ========== LteMacBase ==========
     // ================================
@@ -156,6 +170,12 @@ class UeMac : public NRMacUe
      */
     virtual void initialize(int stage) override;
 
+    /**
+     * When the vehicle is deleted during the simulation (see Database::retireVehicle),
+     * detach the UE from the AMC of all gNBs it was attached to
+     */
+    virtual void finish() override;
+
     /**
      * Analyze gate of incoming packet
      * and call proper handler
@@ -26,7 +26,8 @@ MecNRAmc::MecNRAmc(LteMacEnb *mac, Binder *binder, CellInfo *cellInfo, int numAn
     EV << "Reset Amc pilot to VecPilot"<< endl;
     delete pilot_;
     pilot_ = nullptr;
-    pilot_ = new MecPilot(this);
+    mecPilot_ = new MecPilot(this);
+    pilot_ = mecPilot_;
 }
 
 MecNRAmc::~MecNRAmc()
@@ -51,78 +52,27 @@ unsigned int MecNRAmc::getSymbolsPerSlot(double carrierFrequency, Direction dir)
 
 unsigned int MecNRAmc::getResourceElementsPerBlock(unsigned int symbolsPerSlot)
 {
-    unsigned int numSubcarriers = 12;   // TODO get this parameter from CellInfo/Carrier
-    unsigned int reSignal = 1;
-    unsigned int nOverhead = 0;
-
-    if (symbolsPerSlot == 0)
-        return 0;
-    return (numSubcarriers * symbolsPerSlot) - reSignal - nOverhead;
+    return mecResourceElementsPerBlock(symbolsPerSlot);
 }
 
 unsigned int MecNRAmc::getResourceElements(unsigned int blocks, unsigned int symbolsPerSlot)
 {
-    unsigned int numRePerBlock = getResourceElementsPerBlock(symbolsPerSlot);
-
-    if (numRePerBlock > 156)
-        return 156 * blocks;
-
-    return numRePerBlock * blocks;
+    return mecResourceElements(blocks, symbolsPerSlot);
 }
 
 unsigned int MecNRAmc::computeTbsFromNinfo(double nInfo, double coderate)
 {
-    unsigned int tbs = 0;
-    unsigned int _nInfo = 0;
-    unsigned int n = 0;
-    if (nInfo == 0)
-        return 0;
-
-    if (nInfo <= 3824)
-    {
-        n = std::max((int)3, (int)(floor(log2(nInfo) - 6)));
-        _nInfo = std::max((unsigned int)24, (unsigned int)((1 << n) * floor(nInfo/(1<<n))) );
-
-        // get tbs from table
-        unsigned int j = 0;
-        for (j = 0; j < TBSTABLESIZE-1; j++)
-        {
-            if (nInfoToTbs[j] >= _nInfo )
-                break;
-        }
-
-        tbs = nInfoToTbs[j];
-    }
-    else
-    {
-        unsigned int C;
-        n = floor( log2(nInfo - 24) - 5);
-        _nInfo = ( 1 << n ) * round( (nInfo - 24) / (1 << n));
-        if (coderate <= 0.25 )
-        {
-            C = ceil( (_nInfo+24) / 3816 );
-            tbs = 8 * C * ceil( (_nInfo+24) / (8*C) ) - 24;
-        }
-        else
-        {
-            if (_nInfo >= 8424)
-            {
-                C = ceil( (_nInfo+24) / 8424 );
-                tbs = 8 * C * ceil( (_nInfo+24) / (8*C) ) - 24;
-            }
-            else
-            {
-                tbs = 8 * ceil( (_nInfo+24) / 8 ) - 24;
-            }
-        }
-    }
-    return tbs;
+    return mecTbsFromNinfo(nInfo, coderate);
 }
 
 unsigned int MecNRAmc::computeCodewordTbs(UserTxParams* info, Codeword cw, Direction dir, unsigned int numRe)
 {
-    std::vector<unsigned char> layers = info->getLayers();
-    NRMCSelem mcsElem = getMcsElemPerCqi(info->readCqiVector().at(cw), dir);
+    return computeTbs(info->readCqiVector().at(cw), info->getLayers().at(cw), dir, numRe);
+}
+
+unsigned int MecNRAmc::computeTbs(Cqi cqi, unsigned int layers, Direction dir, unsigned int numRe)
+{
+    NRMCSelem mcsElem = getMcsElemPerCqi(cqi, dir);
     unsigned int modFactor;
     switch(mcsElem.mod_)
     {
@@ -132,10 +82,17 @@ unsigned int MecNRAmc::computeCodewordTbs(UserTxParams* info, Codeword cw, Direc
         case _256QAM: modFactor = 8; break;
         default: throw cRuntimeError("MecNRAmc::computeCodewordTbs - unrecognized modulation.");
     }
-    double coderate = mcsElem.coderate_ / 1024;
-    double nInfo = numRe * coderate * modFactor * layers.at(cw);
+    return mecCodewordTbs(modFactor, mcsElem.coderate_ / 1024, layers, numRe);
+}
+
+unsigned int MecNRAmc::getCodewordTbs(Cqi cqi, unsigned int layers, Direction dir, unsigned int blocks, unsigned int symbolsPerSlot)
+{
+    // out of the table range, compute directly
+    if (cqi > MAX_TBS_CQI || layers > MAX_TBS_LAYERS || symbolsPerSlot > MAX_SYMBOLS_PER_SLOT || dir > UL)
+        return computeTbs(cqi, layers, dir, getResourceElements(blocks, symbolsPerSlot));
 
-    return computeTbsFromNinfo(floor(nInfo),coderate);
+    unsigned int key = tbsTableKey(cqi, layers, dir, symbolsPerSlot);
+    return tbsTable_.get(key, blocks, [&]() { return computeTbs(cqi, layers, dir, getResourceElements(blocks, symbolsPerSlot)); });
 }
 
 /********************
@@ -201,10 +158,10 @@ unsigned int MecNRAmc::computeBitsOnNRbs(MacNodeId id, Band b, unsigned int bloc
     EV << NOW << " MecNRAmc::computeBitsOnNRbs Band: " << b << "\n";
     EV << NOW << " MecNRAmc::computeBitsOnNRbs Direction: " << dirToA(dir) << "\n";
 
-    unsigned int numRe = getResourceElements(blocks, getSymbolsPerSlot(carrierFrequency, dir));
+    unsigned int symbolsPerSlot = getSymbolsPerSlot(carrierFrequency, dir);
 
     // Acquiring current user scheduling information
-    UserTxParams info = computeTxParams(id, dir,carrierFrequency);
+    const UserTxParams& info = computeTxParams(id, dir,carrierFrequency);
 
     unsigned int bits = 0;
     unsigned int codewords = info.getLayers().size();
@@ -217,7 +174,7 @@ unsigned int MecNRAmc::computeBitsOnNRbs(MacNodeId id, Band b, unsigned int bloc
             continue;
         }
 
-        unsigned int tbs = computeCodewordTbs(&info, cw, dir, numRe);
+        unsigned int tbs = getCodewordTbs(info.readCqiVector().at(cw), info.getLayers().at(cw), dir, blocks, symbolsPerSlot);
         bits += tbs;
     }
 
@@ -239,10 +196,10 @@ unsigned int MecNRAmc::computeBitsOnNRbs(MacNodeId id, Band b, Codeword cw, unsi
     EV << NOW << " MecNRAmc::computeBitsOnNRbs Codeword: " << cw << "\n";
     EV << NOW << " MecNRAmc::computeBitsOnNRbs Direction: " << dirToA(dir) << "\n";
 
-    unsigned int numRe = getResourceElements(blocks, getSymbolsPerSlot(carrierFrequency, dir));
+    unsigned int symbolsPerSlot = getSymbolsPerSlot(carrierFrequency, dir);
 
     // Acquiring current user scheduling information
-    UserTxParams info = computeTxParams(id, dir,carrierFrequency);
+    const UserTxParams& info = computeTxParams(id, dir,carrierFrequency);
 
     // if CQI == 0 the UE is out of range, thus return 0
     if (info.readCqiVector().at(cw) == 0)
@@ -251,7 +208,7 @@ unsigned int MecNRAmc::computeBitsOnNRbs(MacNodeId id, Band b, Codeword cw, unsi
         return 0;
     }
 
-    unsigned int tbs = computeCodewordTbs(&info, cw, dir, numRe);
+    unsigned int tbs = getCodewordTbs(info.readCqiVector().at(cw), info.getLayers().at(cw), dir, blocks, symbolsPerSlot);
 
     // DEBUG
     EV << NOW << " MecNRAmc::computeBitsOnNRbs Resource Blocks: " << blocks << "\n";
@@ -316,6 +273,9 @@ const UserTxParams& MecNRAmc::getTxParams(MacNodeId id, const Direction dir, dou
 
 void MecNRAmc::rescaleMcs(double rePerRb, Direction dir)
 {
+    // the TBS depends on the MCS table
+    tbsTable_.clear();
+
     if (dir == DL)
     {
         dlMcsTable_.rescale(rePerRb);
@@ -330,6 +290,28 @@ void MecNRAmc::rescaleMcs(double rePerRb, Direction dir)
 }
 
 
+void MecNRAmc::detachUser(MacNodeId nodeId, Direction dir)
+{
+    NRAmc::detachUser(nodeId, dir);
+    mecPilot_->removeCqiSummary(nodeId, dir);
+}
+
+void MecNRAmc::invalidateTxParams(MacNodeId id, const Direction dir)
+{
+    std::map<double,std::vector<UserTxParams> > *txParams = (dir == DL) ? &dlTxParams_ : (dir == UL) ? &ulTxParams_ : (dir == D2D) ? &d2dTxParams_ : throw cRuntimeError("MecNRAmc::invalidateTxParams(): Unrecognized direction");
+    std::map<MacNodeId, unsigned int> *nodeIndex = (dir == DL) ? &dlNodeIndex_ : (dir == UL) ? &ulNodeIndex_ : &d2dNodeIndex_;
+
+    auto indexIt = nodeIndex->find(id);
+    if (indexIt == nodeIndex->end())
+        return;
+
+    for (auto& carrier : *txParams)
+    {
+        if (indexIt->second < carrier.second.size() && carrier.second[indexIt->second].isSet())
+            carrier.second[indexIt->second].restoreDefaultValues();
+    }
+}
+
 void MecNRAmc::pushFeedback(MacNodeId id, Direction dir, LteFeedback fb, double carrierFrequency)
 {
     EV << "Feedback from MacNodeId " << id << " (direction " << dirToA(dir) << ")" << endl;
@@ -364,6 +346,18 @@ void MecNRAmc::pushFeedback(MacNodeId id, Direction dir, LteFeedback fb, double
     EV << "index: " << index << endl;
     (*history)[antenna].at(index).at(txMode).put(fb);
 
+    /***
+     * the pilot only uses the summary of the MACRO antenna with TRANSMIT_DIVERSITY, update its CQI summary
+     * incrementally. If the summary does not change, the UserTxParam computed from it is still valid.
+     */
+    if (antenna != MACRO || txMode != TRANSMIT_DIVERSITY)
+        return;
+    if (!mecPilot_->updateCqiSummary(id, dir, carrierFrequency, (*history)[antenna].at(index).at(txMode).get()))
+    {
+        EV << "Feedback summary unchanged, keep the transmission parameters" << endl;
+        return;
+    }
+
     // delete the old UserTxParam for this <UE_dir_carrierFreq>, so that it will be recomputed next time it's needed
     std::map<double,std::vector<UserTxParams> > *txParams = (dir == DL) ? &dlTxParams_ : (dir == UL) ? &ulTxParams_ : throw cRuntimeError("MecNRAmc::pushFeedback(): Unrecognized direction");
     if (txParams->find(carrierFrequency) != txParams->end() && txParams->at(carrierFrequency).at(index).isSet())
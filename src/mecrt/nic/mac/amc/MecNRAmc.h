@@ -20,8 +20,12 @@
 #define _MECRT_NRAMC_H_
 
 #include <omnetpp.h>
+#include <climits>
 #include "stack/mac/amc/NRMcs.h"
 #include "stack/mac/amc/NRAmc.h"
+#include "mecrt/nic/mac/amc/MecTbs.h"
+
+class MecPilot;
 
 /**
  * @class MecNRAmc
@@ -33,12 +37,34 @@ class MecNRAmc : public NRAmc
 {
 
   protected:
+    MecPilot *mecPilot_;    // the pilot_ owned by LteAmc, keeps the CQI summaries
+
     virtual unsigned int getSymbolsPerSlot(double carrierFrequency, Direction dir);
     virtual unsigned int getResourceElementsPerBlock(unsigned int symbolsPerSlot);
     virtual unsigned int getResourceElements(unsigned int blocks, unsigned int symbolsPerSlot);
     virtual unsigned int computeTbsFromNinfo(double nInfo, double coderate);
 
     virtual unsigned int computeCodewordTbs(UserTxParams* info, Codeword cw, Direction dir, unsigned int numRe);
+    // TBS of one codeword with the given CQI and number of layers over numRe resource elements
+    virtual unsigned int computeTbs(Cqi cqi, unsigned int layers, Direction dir, unsigned int numRe);
+
+    /***
+     * TBS lookup table, the TBS only depends on (direction, CQI, layers, symbols per slot, blocks).
+     * tbsTable_ is filled on first use (see MecTbsCache), key is computed by tbsTableKey().
+     * The table is reset when the MCS table is rescaled.
+     */
+    static const unsigned int MAX_TBS_CQI = 15;
+    static const unsigned int MAX_TBS_LAYERS = 8;
+    static const unsigned int MAX_SYMBOLS_PER_SLOT = 14;
+    MecTbsCache tbsTable_;
+
+    unsigned int tbsTableKey(Cqi cqi, unsigned int layers, Direction dir, unsigned int symbolsPerSlot) const
+    {
+        return ((dir * (MAX_TBS_CQI + 1) + cqi) * (MAX_TBS_LAYERS + 1) + layers) * (MAX_SYMBOLS_PER_SLOT + 1) + symbolsPerSlot;
+    }
+
+    // look up (or compute and store) the TBS of one codeword on the given number of blocks
+    virtual unsigned int getCodewordTbs(Cqi cqi, unsigned int layers, Direction dir, unsigned int blocks, unsigned int symbolsPerSlot);
 
   public:
 
@@ -48,6 +74,15 @@ class MecNRAmc : public NRAmc
     // CodeRate MCS rescaling
     virtual void rescaleMcs(double rePerRb, Direction dir = DL);
 
+    // detach the user from the AMC and drop its CQI summaries kept by the pilot
+    virtual void detachUser(MacNodeId nodeId, Direction dir);
+
+    /***
+     * reset the UserTxParams of the UE on all carriers so that they are recomputed next time they are needed,
+     * used when the usable bands of the UE change while its CQI summary does not
+     */
+    virtual void invalidateTxParams(MacNodeId id, const Direction dir);
+
     virtual void pushFeedback(MacNodeId id, Direction dir, LteFeedback fb, double carrierFrequency);
     virtual void pushFeedbackD2D(MacNodeId id, LteFeedback fb, MacNodeId peerId, double carrierFrequency);
     virtual const LteSummaryFeedback& getFeedback(MacNodeId id, Remote antenna, TxMode txMode, const Direction dir, double carrierFrequency);
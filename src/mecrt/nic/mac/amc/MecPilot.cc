@@ -44,8 +44,13 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
 
     sfb.print(0,id,dir,txMode,"MecPilot::computeTxParams");
 
-    // get a vector of  CQI over first CW
-    std::vector<Cqi> summaryCqi = sfb.getCqi(0);
+    // the CQI summary is normally kept up to date by MecNRAmc::pushFeedback
+    updateCqiSummary(id, dir, carrierFrequency, sfb);
+    const CqiSummary& summary = cqiSummary_[dir][carrierFrequency][id];
+
+    // CQI over first CW
+    const std::vector<Cqi>& summaryCqi = summary.bandCqi;
+    unsigned int bands = summaryCqi.size();// number of bands
 
     // get the usable bands for this user
     UsableBands* usableB = nullptr;
@@ -64,20 +69,9 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
         // if there are no usable bands, compute the final CQI through all the bands
         if (usableB == nullptr || usableB->empty())
         {
-            chosenBand = 0;
-            chosenCqi = summaryCqi.at(chosenBand);
-            unsigned int bands = summaryCqi.size();// number of bands
-            // computing MAX
-            for(Band b = 1; b < bands; ++b)
-            {
-                // For all Bands
-                double s = (double)summaryCqi.at(b);
-                if(chosenCqi < s)
-                {
-                    chosenBand = b;
-                    chosenCqi = s;
-                }
-            }
+            // computing MAX, the chosen band is the first band with the max CQI
+            chosenCqi = getRankedCqi(summary, 0, true);
+            chosenBand = findBandWithCqi(summary, chosenCqi);
 
             for(Band b = 0; b < bands; ++b)
             {
@@ -127,19 +121,12 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
         // if there are no usable bands, compute the final CQI through all the bands
         if (usableB == nullptr || usableB->empty())
         {
-            chosenBand = 0;
-            chosenCqi = summaryCqi.at(chosenBand);
-            unsigned int bands = summaryCqi.size();// number of bands
-            // computing MIN
+            // computing MIN, the chosen band is the first band with the min CQI
+            chosenCqi = getRankedCqi(summary, 0, false);
+            chosenBand = findBandWithCqi(summary, chosenCqi);
+
             for(Band b = 0; b < bands; ++b)
             {
-                // For all LBs
-                double s = (double)summaryCqi.at(b);
-                if(chosenCqi > s)
-                {
-                    chosenBand = b;
-                    chosenCqi = s;
-                }
                 Band cellWiseBand = amc_->getCellInfo()->getCellwiseBand(carrierFrequency, b);
                 bandSet.insert(cellWiseBand);
             }
@@ -170,40 +157,25 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
     }
     else if(mode_ == ROBUST_CQI)
     {
-        int target = 0;
-        // int s;
-        unsigned int bands = summaryCqi.size();// number of bands
-
         EV << "MecPilot::computeTxParams - computing ROBUST CQI" << endl;
 
-        // // computing MIN
-        // for(Band b = 0; b < bands; ++b)
-        // {
-        //     // For all LBs
-        //     s = summaryCqi.at(b);
-        //     target += s;
-        // }
-        // target = target/bands;
-
-        // EV << "\t target value[" << target << "]" << endl;
-
-        // sort summaryCqi vector in descending order
-        std::sort(summaryCqi.begin(),summaryCqi.end(),std::greater<int>());
-        int quartilePoint = bands/4;
-        target = summaryCqi[quartilePoint];
+        // the first quartile point of the CQIs in descending order
+        int target = getRankedCqi(summary, bands/4, true);
 
         EV << "\t target value[" << target << "]" << endl;
 
-        for(Band b = 0; b < bands; ++b)
+        /***
+         * the band set is taken over the sorted CQI vector (as done so far), i.e., it contains
+         * the first k bands, where k is the number of bands whose CQI is not lower than the target
+         */
+        unsigned int numAboveTarget = 0;
+        for (unsigned int cqi = target; cqi < summary.cqiCount.size(); ++cqi)
+            numAboveTarget += summary.cqiCount[cqi];
+
+        for(Band b = 0; b < numAboveTarget; ++b)
         {
-            if( summaryCqi.at(b) >= target )
-            {
-                EV << b << ")" << summaryCqi.at(b) << "yes" << endl;
-                Band cellWiseBand = amc_->getCellInfo()->getCellwiseBand(carrierFrequency, b);
-                bandSet.insert(cellWiseBand);
-            }
-            else
-                EV << b << ")" << summaryCqi.at(b) << "no" << endl;
+            Band cellWiseBand = amc_->getCellInfo()->getCellwiseBand(carrierFrequency, b);
+            bandSet.insert(cellWiseBand);
         }
         chosenBand = 0;
         chosenCqi = target;
@@ -211,10 +183,10 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
     else if (mode_ == AVG_CQI)
     {
         // MEAN cqi computation method
-        chosenCqi = getBinder()->meanCqi(sfb.getCqi(0),id,dir);
-        for (Band i = 0; i < sfb.getCqi(0).size(); ++i)
+        chosenCqi = getBinder()->meanCqi(summaryCqi,id,dir);
+        for (Band i = 0; i < bands; ++i)
         {
-            if (sfb.getCqi(0).at(i) >= chosenCqi)
+            if (summaryCqi.at(i) >= chosenCqi)
             {
                 Band cellWiseBand = amc_->getCellInfo()->getCellwiseBand(carrierFrequency, i);
                 bandSet.insert(cellWiseBand);
@@ -224,11 +196,11 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
     }
     else if (mode_ == MEDIAN_CQI)
     {
-        // MEAN cqi computation method
-        chosenCqi = getBinder()->medianCqi(sfb.getCqi(0),id,dir);
-        for (Band i = 0; i < sfb.getCqi(0).size(); ++i)
+        // MEDIAN cqi computation method, the element at position bands/2 of the CQIs in ascending order
+        chosenCqi = getRankedCqi(summary, bands/2, false);
+        for (Band i = 0; i < bands; ++i)
         {
-            if (sfb.getCqi(0).at(i) >= chosenCqi)
+            if (summaryCqi.at(i) >= chosenCqi)
             {
                 Band cellWiseBand = amc_->getCellInfo()->getCellwiseBand(carrierFrequency, i);
                 bandSet.insert(cellWiseBand);
@@ -255,6 +227,102 @@ const UserTxParams& MecPilot::computeTxParams(MacNodeId id, const Direction dir,
     return amc_->setTxParams(id, dir, info, carrierFrequency);
 }
 
+bool MecPilot::updateCqiSummary(MacNodeId id, const Direction dir, double carrierFrequency, const LteSummaryFeedback& sfb)
+{
+    CqiSummary& summary = cqiSummary_[dir][carrierFrequency][id];
+    std::vector<Cqi> bandCqi = sfb.getCqi(0);
+    bool changed = false;
+
+    if (summary.bandCqi.size() != bandCqi.size())
+    {
+        // first summary (or the number of bands changed), rebuild the histogram
+        summary.bandCqi = bandCqi;
+        summary.bandPmi.assign(bandCqi.size(), 0);
+        summary.cqiCount.assign(MAX_SUMMARY_CQI + 1, 0);
+        for (Cqi cqi : bandCqi)
+        {
+            if (cqi >= summary.cqiCount.size())
+                summary.cqiCount.resize(cqi + 1, 0);
+            summary.cqiCount[cqi]++;
+        }
+        changed = true;
+    }
+    else
+    {
+        // only apply the bands whose CQI changed
+        for (Band b = 0; b < bandCqi.size(); ++b)
+        {
+            Cqi oldCqi = summary.bandCqi[b];
+            Cqi newCqi = bandCqi[b];
+            if (oldCqi == newCqi)
+                continue;
+
+            if (newCqi >= summary.cqiCount.size())
+                summary.cqiCount.resize(newCqi + 1, 0);
+            summary.cqiCount[oldCqi]--;
+            summary.cqiCount[newCqi]++;
+            summary.bandCqi[b] = newCqi;
+            changed = true;
+        }
+    }
+
+    // rank and PMI are also part of the transmission parameters
+    if (summary.ri != sfb.getRi())
+    {
+        summary.ri = sfb.getRi();
+        changed = true;
+    }
+    for (Band b = 0; b < summary.bandPmi.size(); ++b)
+    {
+        Pmi pmi = sfb.getPmi(b);
+        if (summary.bandPmi[b] != pmi)
+        {
+            summary.bandPmi[b] = pmi;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void MecPilot::removeCqiSummary(MacNodeId id, const Direction dir)
+{
+    auto dirIt = cqiSummary_.find(dir);
+    if (dirIt == cqiSummary_.end())
+        return;
+
+    for (auto& freqIt : dirIt->second)
+        freqIt.second.erase(id);
+}
+
+Cqi MecPilot::getRankedCqi(const CqiSummary& summary, unsigned int rank, bool descending) const
+{
+    if (summary.bandCqi.empty())
+        throw cRuntimeError("MecPilot::getRankedCqi - no band CQI available");
+
+    unsigned int seen = 0;
+    unsigned int numValues = summary.cqiCount.size();
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        unsigned int cqi = descending ? numValues - 1 - i : i;
+        seen += summary.cqiCount[cqi];
+        if (seen > rank)
+            return cqi;
+    }
+
+    throw cRuntimeError("MecPilot::getRankedCqi - rank %u out of range (%u bands)", rank, (unsigned int)summary.bandCqi.size());
+}
+
+Band MecPilot::findBandWithCqi(const CqiSummary& summary, Cqi cqi) const
+{
+    for (Band b = 0; b < summary.bandCqi.size(); ++b)
+    {
+        if (summary.bandCqi[b] == cqi)
+            return b;
+    }
+    return 0;
+}
+
 std::vector<Cqi> MecPilot::getMultiBandCqi(MacNodeId id , const Direction dir, double carrierFrequency)
 {
     EV << NOW << " MecPilot::getMultiBandCqi for UE " << id << ", direction " << dirToA(dir) << endl;
@@ -36,6 +36,28 @@ class MecPilot : public AmcPilot
   protected:
     MecNRAmc *amc_;
 
+    /***
+     * summary of the latest feedback of one UE (MACRO antenna, TRANSMIT_DIVERSITY, first codeword).
+     * cqiCount_ is a histogram of the band CQIs (CQI takes values in [0, 15]), which serves as the
+     * order-statistics structure for MAX/MIN/MEDIAN/ROBUST CQI. It is updated incrementally from the
+     * bands whose CQI changed.
+     */
+    struct CqiSummary
+    {
+        std::vector<Cqi> bandCqi;
+        std::vector<Pmi> bandPmi;
+        Rank ri = 0;
+        std::vector<unsigned int> cqiCount;
+    };
+    // {direction: {carrierFrequency: {ueId: summary}}}
+    std::map<Direction, std::map<double, std::map<MacNodeId, CqiSummary>>> cqiSummary_;
+    static const Cqi MAX_SUMMARY_CQI = 15;
+
+    // the CQI at the given rank (0-based) of the band CQIs sorted in ascending or descending order
+    Cqi getRankedCqi(const CqiSummary& summary, unsigned int rank, bool descending) const;
+    // the first band whose CQI equals cqi
+    Band findBandWithCqi(const CqiSummary& summary, Cqi cqi) const;
+
   public:
     
     /**
@@ -74,6 +96,15 @@ class MecPilot : public AmcPilot
      */
     bool getUsableBands(MacNodeId id, UsableBands*& uBands);
 
+    /***
+     * update the CQI summary of the UE from its summary feedback, only the bands whose value
+     * changed are applied to the histogram. Returns true if the summary changed.
+     */
+    bool updateCqiSummary(MacNodeId id, const Direction dir, double carrierFrequency, const LteSummaryFeedback& sfb);
+
+    // drop the CQI summaries of the UE on all carriers, invoked when the UE is detached from the AMC
+    void removeCqiSummary(MacNodeId id, const Direction dir);
+
     // returns a vector with one CQI for each band ( for the given user )
     std::vector<Cqi>  getMultiBandCqi(MacNodeId id, const Direction dir, double carrierFrequency);
 };
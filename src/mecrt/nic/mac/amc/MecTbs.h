@@ -0,0 +1,180 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    MecTbs.h
+//
+//  Description:
+//    This file implements the TBS arithmetic of 3GPP TS 38.214 5.1.3.2 used by MecNRAmc, i.e., the
+//    compile-time N_info -> TBS table for small N_info and the memoized per-key TBS table.
+//    It only depends on the standard library, so it can be used by the standalone benchmark in
+//    tools/tbsBench, which checks it against the original simu5g computation.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#ifndef _MECRT_MECTBS_H_
+#define _MECRT_MECTBS_H_
+
+#include <climits>
+#include <cmath>
+#include <vector>
+
+/***
+ * TBS for N_info <= 3824, 3GPP TS 38.214 Table 5.1.3.2-1
+ */
+static constexpr unsigned int MEC_NINFO_TO_TBS[] = {
+      24,   32,   40,   48,   56,   64,   72,   80,   88,   96,  104,  112,  120,  128,  136,  144,
+     152,  160,  168,  176,  184,  192,  208,  224,  240,  256,  272,  288,  304,  320,  336,  352,
+     368,  384,  408,  432,  456,  480,  504,  528,  552,  576,  608,  640,  672,  704,  736,  768,
+     808,  848,  888,  928,  984, 1032, 1064, 1128, 1160, 1192, 1224, 1256, 1288, 1320, 1352, 1416,
+    1480, 1544, 1608, 1672, 1736, 1800, 1864, 1928, 2024, 2088, 2152, 2216, 2280, 2408, 2472, 2536,
+    2600, 2664, 2728, 2792, 2856, 2976, 3104, 3240, 3368, 3496, 3624, 3752, 3824
+};
+static constexpr unsigned int MEC_NINFO_TO_TBS_SIZE = sizeof(MEC_NINFO_TO_TBS) / sizeof(MEC_NINFO_TO_TBS[0]);
+static constexpr unsigned int MEC_SMALL_NINFO_MAX = 3824;
+
+/***
+ * TBS of every integer N_info in [0, 3824], computed at compile time with the quantization
+ * of TS 38.214 5.1.3.2: n = max(3, floor(log2(N_info)) - 6), N'_info = max(24, 2^n * floor(N_info / 2^n))
+ */
+struct MecSmallTbsTable
+{
+    unsigned short tbs[MEC_SMALL_NINFO_MAX + 1];
+
+    constexpr MecSmallTbsTable() : tbs()
+    {
+        for (unsigned int nInfo = 1; nInfo <= MEC_SMALL_NINFO_MAX; ++nInfo)
+        {
+            int msb = 0;    // floor(log2(nInfo))
+            while ((nInfo >> (msb + 1)) != 0)
+                ++msb;
+            int n = (msb - 6 > 3) ? msb - 6 : 3;
+            unsigned int quantized = (nInfo >> n) << n;
+            if (quantized < 24)
+                quantized = 24;
+
+            unsigned int j = 0;
+            while (j < MEC_NINFO_TO_TBS_SIZE - 1 && MEC_NINFO_TO_TBS[j] < quantized)
+                ++j;
+            tbs[nInfo] = MEC_NINFO_TO_TBS[j];
+        }
+    }
+};
+static constexpr MecSmallTbsTable MEC_SMALL_TBS_TABLE;
+
+// spot checks of the quantization against TS 38.214 Table 5.1.3.2-1
+static_assert(MEC_NINFO_TO_TBS_SIZE == 93, "TS 38.214 Table 5.1.3.2-1 has 93 entries");
+static_assert(MEC_SMALL_TBS_TABLE.tbs[1] == 24 && MEC_SMALL_TBS_TABLE.tbs[24] == 24, "N_info below 24 maps to TBS 24");
+static_assert(MEC_SMALL_TBS_TABLE.tbs[33] == 32 && MEC_SMALL_TBS_TABLE.tbs[200] == 208, "n = 3 for N_info < 1024");
+static_assert(MEC_SMALL_TBS_TABLE.tbs[1030] == 1032 && MEC_SMALL_TBS_TABLE.tbs[1040] == 1064, "n = 4 for 1024 <= N_info < 2048");
+static_assert(MEC_SMALL_TBS_TABLE.tbs[3823] == 3824 && MEC_SMALL_TBS_TABLE.tbs[3824] == 3824, "N_info = 3824 is the last table entry");
+
+/***
+ * TBS from N_info (an integer, floor is taken by the caller), TS 38.214 5.1.3.2.
+ * The large N_info branch is kept as in simu5g NRAmc::computeTbsFromNinfo, including its integer divisions,
+ * except that C is at least 1 (simu5g divides by zero for N_info just above 3824 with coderate <= 0.25).
+ */
+inline unsigned int mecTbsFromNinfo(double nInfo, double coderate)
+{
+    unsigned int tbs = 0;
+    unsigned int _nInfo = 0;
+    unsigned int n = 0;
+    if (nInfo == 0)
+        return 0;
+
+    if (nInfo <= MEC_SMALL_NINFO_MAX)
+    {
+        tbs = MEC_SMALL_TBS_TABLE.tbs[(unsigned int)nInfo];
+    }
+    else
+    {
+        unsigned int C;
+        n = floor( log2(nInfo - 24) - 5);
+        _nInfo = ( 1 << n ) * round( (nInfo - 24) / (1 << n));
+        if (coderate <= 0.25 )
+        {
+            C = ceil( (_nInfo+24) / 3816 );
+            if (C == 0)     // the integer division gives 0 for N'_info + 24 < 3816, i.e., N_info just above 3824
+                C = 1;
+            tbs = 8 * C * ceil( (_nInfo+24) / (8*C) ) - 24;
+        }
+        else
+        {
+            if (_nInfo >= 8424)
+            {
+                C = ceil( (_nInfo+24) / 8424 );
+                tbs = 8 * C * ceil( (_nInfo+24) / (8*C) ) - 24;
+            }
+            else
+            {
+                tbs = 8 * ceil( (_nInfo+24) / 8 ) - 24;
+            }
+        }
+    }
+    return tbs;
+}
+
+// resource elements of one block, 12 subcarriers and one RE for the reference signal
+inline unsigned int mecResourceElementsPerBlock(unsigned int symbolsPerSlot)
+{
+    unsigned int numSubcarriers = 12;   // TODO get this parameter from CellInfo/Carrier
+    unsigned int reSignal = 1;
+    unsigned int nOverhead = 0;
+
+    if (symbolsPerSlot == 0)
+        return 0;
+    return (numSubcarriers * symbolsPerSlot) - reSignal - nOverhead;
+}
+
+// resource elements of the given number of blocks, at most 156 per block
+inline unsigned int mecResourceElements(unsigned int blocks, unsigned int symbolsPerSlot)
+{
+    unsigned int numRePerBlock = mecResourceElementsPerBlock(symbolsPerSlot);
+
+    if (numRePerBlock > 156)
+        return 156 * blocks;
+
+    return numRePerBlock * blocks;
+}
+
+// TBS of one codeword with the given modulation order, code rate (in [0, 1]) and number of layers over numRe REs
+inline unsigned int mecCodewordTbs(unsigned int modFactor, double coderate, unsigned int layers, unsigned int numRe)
+{
+    double nInfo = numRe * coderate * modFactor * layers;
+    return mecTbsFromNinfo(floor(nInfo), coderate);
+}
+
+/***
+ * memoized TBS table, table_[key][blocks] is filled on first use by the given compute function,
+ * the key identifies everything else the TBS depends on (see MecNRAmc::tbsTableKey)
+ */
+class MecTbsCache
+{
+  public:
+    static const unsigned int NOT_COMPUTED = UINT_MAX;
+
+    template <typename Compute>
+    unsigned int get(unsigned int key, unsigned int blocks, Compute compute)
+    {
+        if (key >= table_.size())
+            table_.resize(key + 1);
+
+        std::vector<unsigned int>& row = table_[key];
+        if (blocks >= row.size())
+            row.resize(blocks + 1, (unsigned int)NOT_COMPUTED);
+
+        if (row[blocks] == NOT_COMPUTED)
+            row[blocks] = compute();
+
+        return row[blocks];
+    }
+
+    void clear() { table_.clear(); }
+
+  private:
+    std::vector<std::vector<unsigned int>> table_;
+};
+
+#endif /* _MECRT_MECTBS_H_ */
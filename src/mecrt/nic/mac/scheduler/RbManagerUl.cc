@@ -26,7 +26,7 @@ bool RbManagerUl::scheduleGrantedApp(AppId appId)
         return false;
     }
 
-    if (flexibleBands_.size() < numBand)
+    if (countBands(flexibleBands_) < numBand)
     {
         EV << "RbManagerUl::scheduleGrantedApp - not enough flexible bands for newly granted app " << appId << endl;
         return false;
@@ -43,18 +43,10 @@ bool RbManagerUl::scheduleGrantedApp(AppId appId)
     if (minBandDemand <= numBand)
     {
         // allocate the granted bands from the flexible bands to the app
-        auto it = flexibleBands_.begin();
-        for (int i = 0; i < numBand; i++)
-        {
-            appGrantInfos_[appId].grantedBandSet.insert(*it);
-            appGrantedRbMap_[appId][*it] = rbPerBand_; // allocate rb
-            it++;
-        }
+        BandMask allocated = lowestBands(flexibleBands_, numBand);
+        appGrantInfos_[appId].grantedBands |= allocated;
         // remove the allocated bands from the flexible bands
-        for (auto band : appGrantInfos_[appId].grantedBandSet)
-        {
-            flexibleBands_.erase(band);
-        }
+        flexibleBands_ &= ~allocated;
 
         appToBeInitialized_.erase(appId); // remove the app from the to-be-initialized list
         scheduledApp_.insert(appId);
@@ -122,25 +114,18 @@ bool RbManagerUl::schedulePausedApp(AppId appId)
 
     int minBandDemand = getMinimumRequiredBands(appId); // calculate the minimum required bands for the app
     // minBandDemand must be greater than granted bands, otherwise, isGrantEnough() would have returned true
-    int extraBandDemand = minBandDemand - appGrantInfos_[appId].grantedBandSet.size(); // extra bands needed for the app
-    if (extraBandDemand > flexibleBands_.size())
+    int extraBandDemand = minBandDemand - countBands(appGrantInfos_[appId].grantedBands); // extra bands needed for the app
+    if (extraBandDemand > countBands(flexibleBands_))
     {
         EV << "RbManagerUl::schedulePausedApp - not enough flexible bands for app " << appId << endl;
         return false; // not enough flexible bands for the app, continue pausing service
     }
 
-    auto it = flexibleBands_.begin();
-    for (int i = 0; i < extraBandDemand; i++)
-    {
-        appTempRbMap_[appId][*it] = rbPerBand_; // allocate rb
-        appGrantInfos_[appId].tempBands.insert(*it); // add the band to the temporary granted bands
-        it++;
-    }
+    // add the bands to the temporary granted bands
+    BandMask allocated = lowestBands(flexibleBands_, extraBandDemand);
+    appGrantInfos_[appId].tempBands |= allocated;
     // remove the allocated bands from the flexible bands
-    for (auto band : appGrantInfos_[appId].tempBands)
-    {
-        flexibleBands_.erase(band);
-    }
+    flexibleBands_ &= ~allocated;
 
     EV << "RbManagerUl::schedulePausedApp - app " << appId << " is resumed with extra bands allocated." << endl;
     pausedApp_.erase(appId); // remove the app from the paused apps
@@ -156,7 +141,7 @@ bool RbManagerUl::isGrantEnough(AppId appId)
      */
 
     MacNodeId ueId = MacCidToNodeId(appId);
-    int numBand = appGrantInfos_[appId].grantedBandSet.size(); // total granted bands for the app
+    int numBand = countBands(appGrantInfos_[appId].grantedBands); // total granted bands for the app
 
     if (numBand == 0)
     {
@@ -200,22 +185,17 @@ int RbManagerUl::getMinimumRequiredBands(AppId appId)
 void RbManagerUl::readAppRbOccupation(const AppId appId, std::map<Band, unsigned int>& rbMap)
 {
     // read the app resource block occupation status
-    // first check appGrantedRbMap_ for the granted bands
-    if (appGrantedRbMap_.find(appId) != appGrantedRbMap_.end())
-    {
-        for (const auto &it : appGrantedRbMap_[appId])
-        {
-            rbMap[it.first] = it.second; // add the granted bands to the rbMap
-        }
-    }
+    // both granted and temporary granted bands are fully occupied by the app
+    auto it = appGrantInfos_.find(appId);
+    if (it == appGrantInfos_.end())
+        return;
 
-    // then check appTempRbMap_ for the temporary granted bands
-    if (appTempRbMap_.find(appId) != appTempRbMap_.end())
+    BandMask occupied = it->second.grantedBands | it->second.tempBands;
+    while (occupied)
     {
-        for (const auto &it : appTempRbMap_[appId])
-        {
-            rbMap[it.first] = it.second; // add the temporary granted bands to the rbMap
-        }
+        Band band = lowestBand(occupied);
+        rbMap[band] = rbPerBand_;
+        occupied &= occupied - 1;
     }
 }
 
@@ -227,10 +207,9 @@ void RbManagerUl::resetRbStatus()
     pausedApp_.clear();
     appToBeInitialized_.clear();
     vehDataRate_.clear();
-    appGrantedRbMap_.clear();
-    appTempRbMap_.clear();
-    flexibleBands_.clear();
+    flexibleBands_ = 0;
     appGrantInfos_.clear();
+    ueApps_.clear();
 
     initBandStatus(); // re-initialize the band status
 }
@@ -244,15 +223,9 @@ void RbManagerUl::terminateAppService(AppId appId)
     appToBeInitialized_.erase(appId); // remove the app from the apps to be initialized
 
     // restore the flexible bands
-    if (appGrantedRbMap_.find(appId) != appGrantedRbMap_.end())
-    {
-        for (const auto &it : appGrantedRbMap_[appId])
-        {
-            flexibleBands_.insert(it.first); // add the granted bands back to the flexible bands
-        }
-    }
-    appGrantedRbMap_.erase(appId);
-    appGrantInfos_[appId].grantedBandSet.clear(); // clear the granted bands set
+    AppGrantInfo& info = appGrantInfos_[appId];
+    flexibleBands_ |= info.grantedBands; // add the granted bands back to the flexible bands
+    info.grantedBands = 0; // clear the granted bands
 
     // release the granted bands for the app
     releaseTempBands(appId);
@@ -264,25 +237,18 @@ void RbManagerUl::terminateAppService(AppId appId)
 void RbManagerUl::releaseTempBands(AppId appId)
 {
     // release the temporary granted bands for the app
-    if (appTempRbMap_.find(appId) != appTempRbMap_.end())
-    {
-        for (const auto &band : appTempRbMap_[appId])
-        {
-            flexibleBands_.insert(band.first); // add the band back to the flexible bands
-        }
-    }
-    appTempRbMap_.erase(appId); // remove the temporary granted bands
-    appGrantInfos_[appId].tempBands.clear(); // clear the temporary granted bands set
+    AppGrantInfo& info = appGrantInfos_[appId];
+    flexibleBands_ |= info.tempBands; // add the bands back to the flexible bands
+    info.tempBands = 0; // clear the temporary granted bands
 }
 
 
 void RbManagerUl::initBandStatus()
 {
     // initialize the band status for available bands and reserved bands
-    for (int i = 0; i < numBands_; i++)
-    {
-        Band band = static_cast<Band>(i);
-        flexibleBands_.insert(band); // all bands are initially flexible
-    }
+    if (numBands_ > MEC_MAX_BANDS)
+        throw cRuntimeError("RbManagerUl::initBandStatus - %d bands exceed the supported maximum of %d bands per carrier", numBands_, MEC_MAX_BANDS);
+
+    flexibleBands_ = fullBandMask(numBands_); // all bands are initially flexible
 }
 
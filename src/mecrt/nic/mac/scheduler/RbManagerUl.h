@@ -23,8 +23,8 @@ struct AppGrantInfo
 {
     AppId appId;
     int numGrantedBands;
-    set<Band> tempBands; // the temporary granted bands for the app, used for band adjustment
-    set<Band> grantedBandSet; // the granted bands for the app
+    BandMask tempBands = 0; // the temporary granted bands for the app, used for band adjustment
+    BandMask grantedBands = 0; // the granted bands for the app
     omnetpp::simtime_t maxOffloadTime;
     MacNodeId ueId;
     int inputSize;
@@ -71,10 +71,15 @@ class RbManagerUl
     set<AppId> scheduledApp_;  // app that has been scheduled by the scheduler
     set<AppId> pausedApp_;  // app that has been paused due to temporary bad channel quality
     set<AppId> appToBeInitialized_; // app that has not been initialized yet (failed when receiving the grant)
+    map<MacNodeId, set<AppId>> ueApps_;  // apps with grant information indexed by UE, used when handling UE feedback
+    const set<AppId> emptyAppSet_;  // returned for UEs without any granted app
     map<MacNodeId, int> vehDataRate_;  // the data rate for each UE per band per TTI
-    map<AppId, map<Band, unsigned int>> appGrantedRbMap_;  // the resource block map for each app
-    map<AppId, map<Band, unsigned int>> appTempRbMap_;  // the resource block map for each app
-    set<Band> flexibleBands_;  // the flexible bands, free bands other than granted bands
+    /***
+     * band occupation is kept as bitmasks (see AppGrantInfo::grantedBands and tempBands),
+     * each occupied band always holds rbPerBand_ resource blocks, so the RB map of an app is
+     * only materialized when it is read, i.e., readAppRbOccupation()
+     */
+    BandMask flexibleBands_;  // the flexible bands, free bands other than granted bands
     map<AppId, AppGrantInfo> appGrantInfos_;  // the granted service for each app, used for scheduling
 
   public:
@@ -84,6 +89,7 @@ class RbManagerUl
         binder_ = getBinder();
         amc_ = amc;
         dir_ = UL;
+        flexibleBands_ = 0;
 
         // initialize some parameters, these parameters should be set by calling the setter functions
         rbPerBand_ = 1;
@@ -149,23 +155,52 @@ class RbManagerUl
 
     void addScheduledApp(AppId appId) { scheduledApp_.insert(appId); }
     void removeScheduledApp(AppId appId) { scheduledApp_.erase(appId); }
-    set<AppId> getScheduledApp() { return scheduledApp_; }
+    const set<AppId>& getScheduledApp() const { return scheduledApp_; }
+    bool isScheduledApp(AppId appId) const { return scheduledApp_.find(appId) != scheduledApp_.end(); }
 
     void addPausedApp(AppId appId) { pausedApp_.insert(appId); }
     void removePausedApp(AppId appId) { pausedApp_.erase(appId); }
-    set<AppId> getPausedApp() { return pausedApp_; }
+    const set<AppId>& getPausedApp() const { return pausedApp_; }
+    bool isPausedApp(AppId appId) const { return pausedApp_.find(appId) != pausedApp_.end(); }
 
     void addAppToBeInitialized(AppId appId) { appToBeInitialized_.insert(appId); }
     void removeAppToBeInitialized(AppId appId) { appToBeInitialized_.erase(appId); }
-    set<AppId> getAppToBeInitialized() { return appToBeInitialized_; }
+    const set<AppId>& getAppToBeInitialized() const { return appToBeInitialized_; }
+    bool isAppToBeInitialized(AppId appId) const { return appToBeInitialized_.find(appId) != appToBeInitialized_.end(); }
+
+    // the apps of the given UE that hold grant information on this gNB
+    const set<AppId>& getUeApps(MacNodeId ueId) const
+    {
+        auto it = ueApps_.find(ueId);
+        return (it != ueApps_.end()) ? it->second : emptyAppSet_;
+    }
 
-    void setAppGrantInfo(AppId appId, AppGrantInfo appGrantInfo) { appGrantInfos_[appId] = appGrantInfo; }
+    void setAppGrantInfo(AppId appId, AppGrantInfo appGrantInfo)
+    {
+        appGrantInfos_[appId] = appGrantInfo;
+        ueApps_[MacCidToNodeId(appId)].insert(appId);
+    }
     AppGrantInfo& getAppGrantInfo(AppId appId) { return appGrantInfos_[appId]; }
-    void removeAppGrantInfo(AppId appId) { appGrantInfos_.erase(appId); }
+    void removeAppGrantInfo(AppId appId)
+    {
+        appGrantInfos_.erase(appId);
+
+        auto it = ueApps_.find(MacCidToNodeId(appId));
+        if (it != ueApps_.end())
+        {
+            it->second.erase(appId);
+            if (it->second.empty())
+                ueApps_.erase(it);
+        }
+    }
     bool hasAppGrantInfo(AppId appId) { return appGrantInfos_.find(appId) != appGrantInfos_.end(); }
 
-    int getAvailableBands() { return flexibleBands_.size(); }
-    int getAppAllocatedBands(AppId appId) { return appGrantInfos_[appId].grantedBandSet.size() + appGrantInfos_[appId].tempBands.size(); }
+    int getAvailableBands() { return countBands(flexibleBands_); }
+    int getAppAllocatedBands(AppId appId)
+    {
+        AppGrantInfo& info = appGrantInfos_[appId];
+        return countBands(info.grantedBands | info.tempBands);
+    }
 
 };
 
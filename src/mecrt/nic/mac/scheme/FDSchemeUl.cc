@@ -36,12 +36,13 @@ void FDSchemeUl::prepareSchedule()
 
     /***
      * Temporary enumeration to assign available bands list to UEs
+     * the allowed bands are kept as bitmasks in GnbMac and only rewritten when they change
      */
     unsigned int totalBands = mac_->getCellInfo()->getNumBands();
-    //unsigned int totalBands = 3;
-    std::set<Band> allBands;
-    for (int i=0; i < totalBands; ++i)
-        allBands.insert(i);
+    if (totalBands > MEC_MAX_BANDS)
+        throw cRuntimeError("FDSchemeUl::prepareSchedule - %d bands exceed the supported maximum of %d bands per carrier", totalBands, MEC_MAX_BANDS);
+    BandMask allBands = fullBandMask(totalBands);
+    GnbMac* gnbMac = check_and_cast<GnbMac*>(mac_);
 
     for ( ActiveSet::iterator it1 = carrierActiveConnectionSet_.begin ();it1 != carrierActiveConnectionSet_.end (); )
     {
@@ -53,7 +54,7 @@ void FDSchemeUl::prepareSchedule()
         /***
          * TODO: the available bands should be set with the scheduling algorithms
          */
-        check_and_cast<GnbMac*>(mac_)->setAllowedBandsUeUl(nodeId, allBands);
+        gnbMac->setAllowedBandMaskUeUl(nodeId, allBands);
     }
 
 
@@ -86,24 +87,30 @@ void FDSchemeUl::prepareSchedule()
          * In this case, we should use the MIN_CQI pilot mode (set in GnbMac.ned, initialized in GnbMac::initialization)
          * when design the scheduling algorithm to ensure all bands are accessible by UEs.
          * ***** otherwise, it is a new scheduling problem *******
+         *
+         * The AMC keeps the restricted tx params until the next CQI update, so they are only
+         * rewritten when the bands satisfying the CQI requirement include a band that is not allowed.
          */
-        UserTxParams * ueTxParams = infoTemp.dup();
+        BandMask usableBands = 0;  // set of bands satisfies CQI requirement
+        for (Band b : infoTemp.readBands())
+            usableBands |= bandToMask(b);
+        BandMask allowedB = gnbMac->getAllowedBandMaskUeUl(nodeId);    // bands allocated
 
-        std::set<Band> bandsForUeUl;
-        const std::set<Band>& allowedBands = infoTemp.readBands();  // set of bands satisfies CQI requirement
-        std::set<Band>& allowedB = check_and_cast<GnbMac*>(mac_)->getAllowedBandsUeUl(nodeId);    // bands allocated
-
-        for (std::set<Band>::iterator itBand = allowedB.begin(); itBand != allowedB.end(); ++itBand) {
-            auto itB = allowedBands.find(*itBand);
-            if (itB != allowedBands.end())
+        const UserTxParams* txParams = &infoTemp;
+        if ((usableBands & ~allowedB) != 0)
+        {
+            UserTxParams ueTxParams(infoTemp);
+            std::set<Band> bandsForUeUl;
+            for (BandMask m = usableBands & allowedB; m; m &= m - 1)
             {
-                bandsForUeUl.insert(*itB);
-                EV << "FDSchemeUl::prepareSchedule - adding usable band " << *itB   << " for UE " << nodeId << endl;
+                bandsForUeUl.insert(lowestBand(m));
+                EV << "FDSchemeUl::prepareSchedule - adding usable band " << lowestBand(m) << " for UE " << nodeId << endl;
             }
-        }
 
-        ueTxParams->writeBands(bandsForUeUl);
-        const UserTxParams& info = mac_->getAmc()->setTxParams(nodeId, direction_, (*ueTxParams), carrierFrequency_);
+            ueTxParams.writeBands(bandsForUeUl);
+            txParams = &mac_->getAmc()->setTxParams(nodeId, direction_, ueTxParams, carrierFrequency_);
+        }
+        const UserTxParams& info = *txParams;
 
         /***
          * the number of layers for each codeword is only greater than 1 (which is 2) when
@@ -5,21 +5,53 @@
 // 
 #include "mecrt/nic/phy/ChannelModel/MecChannelModel.h"
 #include "stack/phy/layer/LtePhyUe.h"
+#include "mecrt/nic/phy/UePhy.h"
 
 Define_Module(MecChannelModel);
 
+void MecChannelModel::initialize(int stage)
+{
+   NRChannelModel_3GPP38_901::initialize(stage);
+
+   if (stage == inet::INITSTAGE_LOCAL)
+   {
+       enablePathLossCache_ = par("enablePathLossCache").boolValue();
+       pathLossCacheEpsilon_ = par("pathLossCacheEpsilon").doubleValue();
+       pathLossCache_.clear();
+
+       enableUlInterferenceCache_ = par("enableUlInterferenceCache").boolValue();
+       ulInterferenceValid_ = false;
+       ulInterference_.clear();
+   }
+}
 
 double MecChannelModel::getAttenuation(MacNodeId nodeId, Direction dir, inet::Coord coord, bool cqiDl)
 {
    double movement = .0;
    double speed = .0;
 
+   // the position of the UE and the gNB, the sender is the gNB in DL
+   inet::Coord phyCoord = getPhyCoord(phy_);
+   inet::Coord ueCoord = (dir == DL) ? phyCoord : coord;
+   inet::Coord gnbCoord = (dir == DL) ? coord : phyCoord;
+
+   // the cached entry is only valid for the same LOS state and (nearly) the same positions
+   PathLossCacheEntry* cached = nullptr;
+   if (enablePathLossCache_)
+   {
+       auto cacheIt = pathLossCache_.find(nodeId);
+       auto losIt = losMap_.find(nodeId);
+       if (cacheIt != pathLossCache_.end() && losIt != losMap_.end() && cacheIt->second.los == losIt->second
+               && isWithinEpsilon(ueCoord, cacheIt->second.ueCoord) && isWithinEpsilon(gnbCoord, cacheIt->second.gnbCoord))
+           cached = &cacheIt->second;
+   }
+
    //COMPUTE 3D and 2D DISTANCE between ue and eNodeB
-   double threeDimDistance = phy_->getCoord().distance(coord);
-   double twoDimDistance = getTwoDimDistance(phy_->getCoord(), coord);
+   double threeDimDistance = cached ? cached->threeDimDistance : phyCoord.distance(coord);
+   double twoDimDistance = cached ? cached->twoDimDistance : getTwoDimDistance(phyCoord, coord);
 
    if (dir == DL) // sender is UE
-       speed = computeSpeed(nodeId, phy_->getCoord());
+       speed = computeSpeed(nodeId, phyCoord);
    else
        speed = computeSpeed(nodeId, coord);
 
@@ -39,7 +71,16 @@ double MecChannelModel::getAttenuation(MacNodeId nodeId, Direction dir, inet::Co
    double attenuation = MEC_OUT_OF_RANGE_ATTENUATION;
    if (twoDimDistance <= MEC_MAX_VALID_2D_DISTANCE)
    {
-       attenuation = computePathLoss(threeDimDistance, twoDimDistance, los);
+       if (cached)
+       {
+           attenuation = cached->pathLoss;
+       }
+       else
+       {
+           attenuation = computePathLoss(threeDimDistance, twoDimDistance, los);
+           if (enablePathLossCache_)
+               pathLossCache_[nodeId] = {ueCoord, gnbCoord, los, threeDimDistance, twoDimDistance, attenuation};
+       }
 
        // Apply shadowing only for links handled by the normal path-loss model.
        if (nodeId < BGUE_MIN_ID && shadowing_)
@@ -51,7 +92,7 @@ double MecChannelModel::getAttenuation(MacNodeId nodeId, Direction dir, inet::Co
    //if sender is a eNodeB
    if (dir == DL)
        //store the position of user
-       updatePositionHistory(nodeId, phy_->getCoord());
+       updatePositionHistory(nodeId, phyCoord);
    else
        //sender is an UE
        updatePositionHistory(nodeId, coord);
@@ -60,3 +101,100 @@ double MecChannelModel::getAttenuation(MacNodeId nodeId, Direction dir, inet::Co
 
    return attenuation;
 }
+
+inet::Coord MecChannelModel::getPhyCoord(LtePhyBase* phy)
+{
+   UePhy* uePhy = dynamic_cast<UePhy*>(phy);
+   return (uePhy != nullptr) ? uePhy->getCurrentCoord() : phy->getCoord();
+}
+
+bool MecChannelModel::buildUlInterference(MacNodeId eNbId, double carrierFrequency)
+{
+   ulInterferenceValid_ = false;
+   ulInterference_.clear();
+
+   const std::vector<std::vector<UeAllocationInfo> >* ulTransmissionMap = binder_->getUlTransmissionMap(carrierFrequency, PREV_TTI);
+   if (ulTransmissionMap != nullptr)
+   {
+       inet::Coord gnbCoord = phy_->getCoord();
+       ulInterference_.resize(ulTransmissionMap->size());
+       for (size_t b = 0; b < ulTransmissionMap->size(); ++b)
+       {
+           UlBandInterference& band = ulInterference_[b];
+           for (const UeAllocationInfo& info : ulTransmissionMap->at(b))
+           {
+               // background UEs are left to the original model
+               if (info.nodeId >= BGUE_MIN_ID || info.phy == nullptr)
+                   return false;
+
+               // no interference from the UEs served by the same gNB
+               if (info.cellId == eNbId)
+                   continue;
+
+               inet::Coord c = getPhyCoord(info.phy);
+               if (getTwoDimDistance(gnbCoord, c) > MEC_MAX_VALID_2D_DISTANCE)
+                   continue;
+
+               double att = getAttenuation(info.nodeId, UL, c, false);
+               double power = dBmToLinear(info.phy->getTxPwr(info.dir) - att);
+               band.interferers.push_back({info.nodeId, power});
+               band.aggregate += power;
+           }
+       }
+   }
+
+   ulInterferenceValid_ = true;
+   ulInterferenceCell_ = eNbId;
+   ulInterferenceFrequency_ = carrierFrequency;
+   ulInterferenceTime_ = NOW;
+   ulInterferenceMapTime_ = binder_->getLastUpdateUlTransmissionInfo();
+
+   EV << "MecChannelModel::buildUlInterference - interference at gNB " << eNbId << " built for " << ulInterference_.size() << " bands" << endl;
+
+   return true;
+}
+
+bool MecChannelModel::computeUplinkInterference(MacNodeId eNbId, MacNodeId senderId, double carrierFrequency,
+                                                const RbMap& rbmap, std::vector<double>* interference)
+{
+   if (!enableUlInterferenceCache_)
+       return NRChannelModel_3GPP38_901::computeUplinkInterference(eNbId, senderId, carrierFrequency, rbmap, interference);
+
+   bool cacheHit = ulInterferenceValid_ && ulInterferenceCell_ == eNbId && ulInterferenceFrequency_ == carrierFrequency
+           && ulInterferenceTime_ == NOW && ulInterferenceMapTime_ == binder_->getLastUpdateUlTransmissionInfo();
+   if (!cacheHit && !buildUlInterference(eNbId, carrierFrequency))
+       return NRChannelModel_3GPP38_901::computeUplinkInterference(eNbId, senderId, carrierFrequency, rbmap, interference);
+
+   size_t numBands = std::min(ulInterference_.size(), interference->size());
+   for (size_t b = 0; b < numBands; ++b)
+   {
+       const UlBandInterference& band = ulInterference_[b];
+
+       bool senderFound = false;
+       for (const UlInterferer& ue : band.interferers)
+       {
+           if (ue.ueId == senderId)
+           {
+               senderFound = true;
+               break;
+           }
+       }
+
+       if (!senderFound)
+       {
+           (*interference)[b] += band.aggregate;
+           continue;
+       }
+
+       // sum again in the order of the transmission map, so that the result does not depend on the cache
+       double sum = 0;
+       for (const UlInterferer& ue : band.interferers)
+       {
+           if (ue.ueId != senderId)
+               sum += ue.power;
+       }
+       (*interference)[b] += sum;
+   }
+
+   return true;
+}
@@ -18,7 +18,80 @@ class MecChannelModel : public NRChannelModel_3GPP38_901
     double MEC_MAX_VALID_2D_DISTANCE = 5000.0;
     double MEC_OUT_OF_RANGE_ATTENUATION = 1000.0;
 
+    /***
+     * path loss cache of each UE, the path loss only depends on the positions of the two
+     * end points and the LOS state. The entry is reused as long as the LOS state is the same and
+     * both end points moved no more than pathLossCacheEpsilon_ since it was computed.
+     * Shadowing, speed and position history are still updated on every call.
+     */
+    struct PathLossCacheEntry
+    {
+        inet::Coord ueCoord;
+        inet::Coord gnbCoord;
+        bool los;
+        double threeDimDistance;
+        double twoDimDistance;
+        double pathLoss;
+    };
+    std::map<MacNodeId, PathLossCacheEntry> pathLossCache_;   // {ueId: entry}
+    bool enablePathLossCache_;
+    double pathLossCacheEpsilon_;   // the movement (m) below which the cached path loss is reused, 0 means exact positions
+
+    // whether point a is within the cache epsilon of point b
+    bool isWithinEpsilon(const inet::Coord& a, const inet::Coord& b) const
+    {
+        if (pathLossCacheEpsilon_ <= 0)
+            return a == b;
+        return a.sqrdist(b) <= pathLossCacheEpsilon_ * pathLossCacheEpsilon_;
+    }
+
+    /***
+     * uplink interference cache of the receiving gNB, rebuilt once per TTI from the UL transmission
+     * map of the binder. Interferers beyond MEC_MAX_VALID_2D_DISTANCE are culled, since their
+     * attenuation is MEC_OUT_OF_RANGE_ATTENUATION and their received power is far below the noise floor.
+     * For each band, the in-range interferers are kept in the order of the transmission map, together
+     * with their aggregate received power (linear, mW).
+     */
+    struct UlInterferer
+    {
+        MacNodeId ueId;
+        double power;
+    };
+    struct UlBandInterference
+    {
+        std::vector<UlInterferer> interferers;
+        double aggregate = 0;
+    };
+    std::vector<UlBandInterference> ulInterference_;   // {band: interference}
+    bool enableUlInterferenceCache_;
+    bool ulInterferenceValid_;
+    MacNodeId ulInterferenceCell_;              // the receiving gNB
+    double ulInterferenceFrequency_;
+    omnetpp::simtime_t ulInterferenceTime_;     // when the cache was built
+    omnetpp::simtime_t ulInterferenceMapTime_;  // the last update of the binder UL transmission map
+
+    /*
+     * the current position of the PHY, a vehicle PHY is refreshed from its mobility module since
+     * lazy mobility does not signal every position change
+     */
+    inet::Coord getPhyCoord(LtePhyBase* phy);
+
+    /*
+     * rebuild the interference cache for the receiving gNB, returns false if the transmission map
+     * contains entries the cache does not handle (i.e., background UEs)
+     */
+    bool buildUlInterference(MacNodeId eNbId, double carrierFrequency);
+
+    /*
+     * Compute the uplink interference on each band at the receiving gNB eNbId, using the cached
+     * per-band aggregate of the current TTI. The sender of the frame is excluded.
+     */
+    virtual bool computeUplinkInterference(MacNodeId eNbId, MacNodeId senderId, double carrierFrequency,
+                                           const RbMap& rbmap, std::vector<double>* interference) override;
+
   public:
+    virtual void initialize(int stage) override;
+
     /*
      * Compute Attenuation caused by pathloss and shadowing (optional)
      *
@@ -11,6 +11,7 @@
 #include "mecrt/packets/nic/VecDataInfo_m.h"
 #include "mecrt/mobility/MecMobility.h"
 #include "mecrt/nic/mac/GnbMac.h"
+#include "mecrt/common/Database.h"
 
 #include "mecrt/packets/apps/VecPacket_m.h"
 #include "mecrt/packets/apps/DistPV_m.h"
@@ -24,6 +25,9 @@ UePhy::UePhy()
     enableInitDebug_ = false;
     das_ = nullptr;
     channelFeedbackTimer_ = nullptr;
+    database_ = nullptr;
+    bandManager_ = nullptr;
+    mobility_ = nullptr;
 }
 
 UePhy::~UePhy()
@@ -56,6 +60,18 @@ UePhy::~UePhy()
         std::cout << "UePhy::~UePhy - destroying PHY protocol done!\n";
 }
 
+void UePhy::finish()
+{
+    NRPhyUe::finish();
+
+    // do this only when the vehicle is deleted during the simulation
+    if (getSimulation()->getSimulationStage() == CTX_FINISH)
+        return;
+
+    if (bandManager_)
+        bandManager_->removeUePhy(nodeId_);
+}
+
 void UePhy::initialize(int stage)
 {
     ChannelAccess::initialize(stage);
@@ -156,6 +172,13 @@ void UePhy::initialize(int stage)
         capAccessibleRsus_ = par("capAccessibleRsus");
         accessibleRsuLimit_ = par("accessibleRsuLimit");
 
+        adaptiveFeedback_ = par("adaptiveFeedback");
+        adaptiveFbDistance_ = par("adaptiveFbDistance");
+        adaptiveFbMaxSilence_ = par("adaptiveFbMaxSilence").intValue() * TTI;
+        lastFbToRsu_.clear();
+        feedbackSentSignal_ = registerSignal("feedbackSent");
+        feedbackDroppedSignal_ = registerSignal("feedbackDropped");
+
         WATCH_SET(grantedRsus_);
         WATCH(resAllocateMode_);
         WATCH(capAccessibleRsus_);
@@ -221,6 +244,9 @@ void UePhy::initialize(int stage)
         bandManager_ = check_and_cast<BandManager*>(getSimulation()->getModuleByPath("bandManager"));
         bandManager_->addUePhy(nodeId_, this, offloadPower_);
 
+        // the gNB grid index is built by the database on the first query
+        database_ = check_and_cast<Database*>(getSimulation()->getModuleByPath("database"));
+
         if (enableInitDebug_)
             std::cout << "UePhy::initialize - stage: INITSTAGE_PHYSICAL_ENVIRONMENT - ends" << std::endl;
     }
@@ -423,9 +449,9 @@ void UePhy::initialize(int stage)
 
         if (isNr_)
         {
-            MecMobility *mobility = check_and_cast<MecMobility*>(getParentModule()->getParentModule()->getSubmodule("mobility"));
-            moveStartTime_ = mobility->getMoveStartTime().dbl();
-            moveStoptime_ = mobility->getMoveStopTime().dbl();
+            mobility_ = check_and_cast<MecMobility*>(getParentModule()->getParentModule()->getSubmodule("mobility"));
+            moveStartTime_ = mobility_->getMoveStartTime().dbl();
+            moveStoptime_ = mobility_->getMoveStopTime().dbl();
 
             // for feedback generation
             feedbackType_ = par("feedbackType").stringValue();
@@ -451,8 +477,18 @@ void UePhy::initialize(int stage)
 }
 
 
+const inet::Coord& UePhy::getCurrentCoord()
+{
+    if (mobility_ != nullptr && mobility_->isLazyMobility())
+        radioPos = mobility_->getCurrentPosition();
+    return radioPos;
+}
+
 void UePhy::handleMessage(cMessage* msg)
 {
+    // the position is used by this module and its channel model while handling the message
+    getCurrentCoord();
+
     if (msg->isSelfMessage())
     {
         EV << "UePhy::handleMessage - self message received: " << msg->getName() << endl;
@@ -519,31 +555,27 @@ void UePhy::updateMasterNode()
         return;
 
     EV << "UePhy::updateMasterNode - master node " << masterId_ << " is down, need to update master node" << endl;
-    // select the closest node as the new master node
+    // select the closest node as the new master node, the index returns all gNBs sorted by distance
     MacNodeId candidateNode = 0;
-    double minDist = 1.0e+10;
-    // get the list of all eNodeBs in the network
-    std::vector<EnbInfo *>* gnbList = binder_->getEnbList();
-    for (auto it = gnbList->begin(); it != gnbList->end(); ++it)
+    GnbGridIndex* gnbIndex = database_->getGnbGridIndex();
+    gnbIndex->queryRange(getCoord(), -1, rsuInRange_);
+    for (const auto& rsuPair : rsuInRange_)
     {
+        EnbInfo* info = gnbIndex->getGnb(rsuPair.second)->info;
+
         // the NR phy layer only checks signal from gNBs
-        if (isNr_ && (*it)->nodeType != GNODEB)
+        if (isNr_ && info->nodeType != GNODEB)
             continue;
 
         // the LTE phy layer only checks signal from eNBs
-        if (!isNr_ && (*it)->nodeType != ENODEB)
+        if (!isNr_ && info->nodeType != ENODEB)
             continue;
 
-        GnbMac* nodeMac = check_and_cast_nullable<GnbMac*>((*it)->mac);
+        GnbMac* nodeMac = check_and_cast_nullable<GnbMac*>(info->mac);
         if (nodeMac && !nodeMac->isNicDisabled())
         {
-            LtePhyBase* nodePhy = (*it)->phy;
-            double dist = nodePhy->getCoord().distance(getCoord());
-            if (dist < minDist)
-            {
-                minDist = dist;
-                candidateNode = (*it)->id;
-            }
+            candidateNode = rsuPair.second;
+            break;
         }
     }
 
@@ -570,6 +602,8 @@ void UePhy::sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector f
     fbPkt->setLteFeedbackDoubleVectorUl(fbUl);
     fbPkt->setSourceNodeId(nodeId_);
 
+    // the feedback packet is the template for all destinations, its LteFeedbackPkt chunk is immutable once
+    // inserted, so each copy of the packet shares the chunk (and its feedback vectors) instead of copying it
     auto pkt = new Packet("feedback_pkt");
     pkt->insertAtFront(fbPkt);
 
@@ -578,19 +612,10 @@ void UePhy::sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector f
     uinfo->setDestId(masterId_);
     uinfo->setFrameType(FEEDBACKPKT);
     uinfo->setIsCorruptible(false);
-    // create LteAirFrame and encapsulate a feedback packet
-    LteAirFrame* frame = new LteAirFrame("feedback_pkt");
-    frame->encapsulate(check_and_cast<cPacket*>(pkt));
     uinfo->feedbackReq = req;
     uinfo->setDirection(UL);
-    simtime_t signalLength = TTI;
     uinfo->setTxPower(txPower_);
     uinfo->setD2dTxPower(d2dTxPower_);
-    // initialize frame fields
-
-    frame->setSchedulingPriority(airFramePriority_-1);
-    frame->setDuration(signalLength);
-
     uinfo->setCoord(getCoord());
 
     //TODO access speed data Update channel index
@@ -630,24 +655,20 @@ void UePhy::sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector f
              * in sendBroadcast(), the airFrame is sent to neighbors (gNB within the max interference distance)
              */
             map<MacNodeId, double> accessibleRsuMap;
-            for (MacNodeId destId : rsuSet_)
+            /***
+             * if the RSU is too far and no service currently running on it, skip it
+             * this is to avoid sending feedback to RSUs that are not in the range of SRS
+             * and thus cannot receive the feedback. The range query on the gNB grid index only
+             * returns the RSUs within srsDistance_ (all RSUs if the distance is not checked)
+             */
+            database_->getGnbGridIndex()->queryRange(getCoord(), srsDistanceCheck_ ? srsDistance_ : -1, rsuInRange_);
+            for (const auto& rsuPair : rsuInRange_)
             {
-                // compute the distance to the RSU
-                cModule *receiver = getSimulation()->getModule(binder_->getOmnetId(destId));
-                LtePhyBase *recvPhy;
-                // get the correct PHY layer module
-                recvPhy = (isNrUe(destId)) ? check_and_cast<LtePhyBase *>(receiver->getSubmodule("cellularNic")->getSubmodule("nrPhy"))
-                                            : check_and_cast<LtePhyBase *>(receiver->getSubmodule("cellularNic")->getSubmodule("phy"));
-                double dist = recvPhy->getCoord().distance(getCoord());
-                
-                // if the RSU is too far and no service currently running on it, skip it
-                // this is to avoid sending feedback to RSUs that are not in the range of SRS
-                // and thus cannot receive the feedback
-                // EV << "UePhy::sendFeedback - RSU " << destId << " is too far (" << dist << " > " << srsDistance_ << "), skipping transmission" << endl;
-                if (srsDistanceCheck_ && (dist > srsDistance_))
+                MacNodeId destId = rsuPair.second;
+                if (rsuSet_.find(destId) == rsuSet_.end())
                     continue;
-                    
-                accessibleRsuMap[destId] = dist;
+
+                accessibleRsuMap[destId] = rsuPair.first;
             }
 
             // sort the accessible RSUs based on the distance
@@ -694,16 +715,8 @@ void UePhy::sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector f
             // first send to the granted RSUs
             for (MacNodeId destId : grantedRsus_)
             {
-                LteAirFrame* carrierFrame = frame->dup();
-                UserControlInfo* carrierInfo = uinfo->dup();
-                carrierInfo->setCarrierFrequency(carrierFrequency);
-                carrierInfo->setDestId(destId);
-                carrierInfo->setIsBroadcast(true);
-                carrierFrame->setControlInfo(carrierInfo);
-
-                EV << "UePhy::sendFeedback - " << nodeTypeToA(nodeType_) << " with id "
-                    << nodeId_ << " sending feedback to RSU " << destId << endl;
-                sendUnicast(carrierFrame);
+                sendFeedbackToRsu(pkt, uinfo, destId, carrierFrequency, true);
+                recordFeedbackSent(destId);
             }
             // then send to the other accessible RSUs that is in range
             for (MacNodeId destId : sortedAccessibleRsus_)
@@ -712,16 +725,7 @@ void UePhy::sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector f
                 if (grantedRsus_.find(destId) != grantedRsus_.end())
                     continue;
 
-                LteAirFrame* carrierFrame = frame->dup();
-                UserControlInfo* carrierInfo = uinfo->dup();
-                carrierInfo->setCarrierFrequency(carrierFrequency);
-                carrierInfo->setDestId(destId);
-                carrierInfo->setIsBroadcast(true);
-                carrierFrame->setControlInfo(carrierInfo);
-
-                EV << "UePhy::sendFeedback - " << nodeTypeToA(nodeType_) << " with id "
-                    << nodeId_ << " sending feedback to RSU " << destId << endl;
-                sendUnicast(carrierFrame);
+                sendFeedbackToRsu(pkt, uinfo, destId, carrierFrequency, true);
             }
             
             if (enableDistScheme_ && distReady_)
@@ -751,24 +755,73 @@ void UePhy::sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector f
                 // send feedback to the granted node
                 for (MacNodeId destId : grantedRsus_)
                 {
-                    LteAirFrame* carrierFrame = frame->dup();
-                    UserControlInfo* carrierInfo = uinfo->dup();
-                    carrierInfo->setCarrierFrequency(carrierFrequency);
-                    carrierInfo->setDestId(destId);
-                    carrierFrame->setControlInfo(carrierInfo);
-
-                    EV << "UePhy::sendFeedback - " << nodeTypeToA(nodeType_) << " with id "
-                        << nodeId_ << " sending feedback to RSU " << destId << endl;
-                    sendUnicast(carrierFrame);
+                    if (adaptiveFeedback_ && !isFeedbackNeeded(destId))
+                    {
+                        EV << "UePhy::sendFeedback - channel to RSU " << destId << " barely changed, skip the feedback" << endl;
+                        emit(feedbackDroppedSignal_, 1L);
+                        continue;
+                    }
+
+                    sendFeedbackToRsu(pkt, uinfo, destId, carrierFrequency, false);
+                    recordFeedbackSent(destId);
                 }
             }
         }
     }
 
-    delete frame;
+    delete pkt;
     delete uinfo;
 }
 
+void UePhy::sendFeedbackToRsu(const Packet* fbPkt, const UserControlInfo* uinfo, MacNodeId destId, double carrierFrequency, bool isBroadcast)
+{
+    // only the air frame, the packet wrapper and the control info are allocated per destination
+    LteAirFrame* carrierFrame = new LteAirFrame("feedback_pkt");
+    carrierFrame->encapsulate(fbPkt->dup());
+    carrierFrame->setSchedulingPriority(airFramePriority_-1);
+    carrierFrame->setDuration(TTI);
+
+    UserControlInfo* carrierInfo = uinfo->dup();
+    carrierInfo->setCarrierFrequency(carrierFrequency);
+    carrierInfo->setDestId(destId);
+    if (isBroadcast)
+        carrierInfo->setIsBroadcast(true);
+    carrierFrame->setControlInfo(carrierInfo);
+
+    EV << "UePhy::sendFeedback - " << nodeTypeToA(nodeType_) << " with id "
+        << nodeId_ << " sending feedback to RSU " << destId << endl;
+    sendUnicast(carrierFrame);
+}
+
+bool UePhy::isFeedbackNeeded(MacNodeId rsuId)
+{
+    auto it = lastFbToRsu_.find(rsuId);
+    if (it == lastFbToRsu_.end())
+        return true;
+
+    if (NOW - it->second.first >= adaptiveFbMaxSilence_)
+        return true;
+
+    const GnbIndexEntry* rsu = database_->getGnbGridIndex()->getGnb(rsuId);
+    if (rsu == nullptr)
+        return true;
+
+    double dist = rsu->coord.distance(getCoord());
+    return fabs(dist - it->second.second) > adaptiveFbDistance_;
+}
+
+void UePhy::recordFeedbackSent(MacNodeId rsuId)
+{
+    emit(feedbackSentSignal_, 1L);
+
+    if (!adaptiveFeedback_ || grantedRsus_.find(rsuId) == grantedRsus_.end())
+        return;
+
+    const GnbIndexEntry* rsu = database_->getGnbGridIndex()->getGnb(rsuId);
+    double dist = rsu ? rsu->coord.distance(getCoord()) : 0;
+    lastFbToRsu_[rsuId] = make_pair(NOW, dist);
+}
+
 void UePhy::sendBroadcast(LteAirFrame *airFrame)
 {
     EV << NOW << " UePhy::sendBroadcast - broadcast airframe."<< endl;
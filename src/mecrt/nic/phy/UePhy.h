@@ -16,6 +16,8 @@
 
 
 class BandManager;
+class Database;
+class MecMobility;
 
 /**
  * @class LtePhy
@@ -50,7 +52,13 @@ class UePhy : public NRPhyUe
     ~UePhy();
 
 	virtual void addGrantedRsu(MacNodeId id) { grantedRsus_.insert(id); }
-	virtual void removeGrantedRsu(MacNodeId id) { grantedRsus_.erase(id); }
+	virtual void removeGrantedRsu(MacNodeId id) { grantedRsus_.erase(id); lastFbToRsu_.erase(id); }
+
+    /***
+     * the current position of the vehicle. With lazy mobility the mobility module does not signal every
+     * position change, so the position cached by ChannelAccess is refreshed from the mobility module here
+     */
+    virtual const inet::Coord& getCurrentCoord();
 
   protected:
     bool enableInitDebug_;
@@ -69,6 +77,7 @@ class UePhy : public NRPhyUe
        */
     double offloadPower_;
     BandManager *bandManager_;
+    MecMobility *mobility_;   // the mobility module of the vehicle
 
     /***
      * Only do broadcasting when the scheduling is going to start
@@ -77,6 +86,18 @@ class UePhy : public NRPhyUe
      */
     set<MacNodeId> grantedRsus_;
 
+    /***
+     * adaptive feedback: outside the broadcast window before scheduling, the unicast feedback to a granted RSU
+     * is only sent when the distance to the RSU (as the estimate of the channel quality change) changed
+     * by more than adaptiveFbDistance_ or no feedback was sent to it for adaptiveFbMaxSilence_
+     */
+    bool adaptiveFeedback_;
+    double adaptiveFbDistance_;
+    double adaptiveFbMaxSilence_;
+    map<MacNodeId, pair<simtime_t, double>> lastFbToRsu_;  // {rsuId: (time, distance)} of the last feedback sent
+    omnetpp::simsignal_t feedbackSentSignal_;
+    omnetpp::simsignal_t feedbackDroppedSignal_;
+
     // for feedback generation
     omnetpp::cMessage *channelFeedbackTimer_;   /// self message to trigger the channel feedback generation
     string feedbackType_;  // the type of feedback to send, e.g., ALLBANDS, PREFERRED, WIDEBAND
@@ -97,6 +118,8 @@ class UePhy : public NRPhyUe
 
     // ========= for broadcasting =========
     set<MacNodeId> rsuSet_;  // the list of RSUs in the simulation
+    Database* database_;  // hosts the shared spatial index of the gNBs, with their cached PHY modules
+    vector<pair<double, MacNodeId>> rsuInRange_;  // buffer for the range query, (distance, rsuId)
 
     // =====================================================
     // ========= for distributed scheduling scheme =========
@@ -162,6 +185,11 @@ class UePhy : public NRPhyUe
     // update master node incase of the master node fails
     virtual void updateMasterNode();
 
+    // whether the unicast feedback to the granted RSU should be sent, in adaptive feedback mode
+    virtual bool isFeedbackNeeded(MacNodeId rsuId);
+    // record the time and distance of the feedback sent to the RSU
+    virtual void recordFeedbackSent(MacNodeId rsuId);
+
 
     // ================================
     // ========= LtePhyUeD2D ==========
@@ -170,6 +198,8 @@ class UePhy : public NRPhyUe
      * Send Feedback, called by feedback generator in DL
      */
     virtual void sendFeedback(LteFeedbackDoubleVector fbDl, LteFeedbackDoubleVector fbUl, FeedbackRequest req) override;
+    // send the feedback to one RSU, the copy of fbPkt shares its feedback chunk
+    virtual void sendFeedbackToRsu(const inet::Packet* fbPkt, const UserControlInfo* uinfo, MacNodeId destId, double carrierFrequency, bool isBroadcast);
 
     /**
      * Sends the given message to the wireless channel.
@@ -205,6 +235,12 @@ class UePhy : public NRPhyUe
      */
     virtual void initialize(int stage) override;
 
+    /**
+     * When the vehicle is deleted during the simulation (see Database::retireVehicle),
+     * remove the UE from the BandManager
+     */
+    virtual void finish() override;
+
     /**
      * Processes messages received from the wireless channel.
      *
@@ -873,6 +873,406 @@ void Grant2RsuDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, in
     }
 }
 
+Register_Class(Grant2RsuBatch)
+
+Grant2RsuBatch::Grant2RsuBatch() : ::inet::FieldsChunk()
+{
+    this->setChunkLength(inet::B(10));
+
+}
+
+Grant2RsuBatch::Grant2RsuBatch(const Grant2RsuBatch& other) : ::inet::FieldsChunk(other)
+{
+    copy(other);
+}
+
+Grant2RsuBatch::~Grant2RsuBatch()
+{
+}
+
+Grant2RsuBatch& Grant2RsuBatch::operator=(const Grant2RsuBatch& other)
+{
+    if (this == &other) return *this;
+    ::inet::FieldsChunk::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void Grant2RsuBatch::copy(const Grant2RsuBatch& other)
+{
+    this->batchId = other.batchId;
+    this->processGnbId = other.processGnbId;
+    this->numGrants = other.numGrants;
+}
+
+void Grant2RsuBatch::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    ::inet::FieldsChunk::parsimPack(b);
+    doParsimPacking(b,this->batchId);
+    doParsimPacking(b,this->processGnbId);
+    doParsimPacking(b,this->numGrants);
+}
+
+void Grant2RsuBatch::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    ::inet::FieldsChunk::parsimUnpack(b);
+    doParsimUnpacking(b,this->batchId);
+    doParsimUnpacking(b,this->processGnbId);
+    doParsimUnpacking(b,this->numGrants);
+}
+
+unsigned int Grant2RsuBatch::getBatchId() const
+{
+    return this->batchId;
+}
+
+void Grant2RsuBatch::setBatchId(unsigned int batchId)
+{
+    handleChange();
+    this->batchId = batchId;
+}
+
+unsigned short Grant2RsuBatch::getProcessGnbId() const
+{
+    return this->processGnbId;
+}
+
+void Grant2RsuBatch::setProcessGnbId(unsigned short processGnbId)
+{
+    handleChange();
+    this->processGnbId = processGnbId;
+}
+
+int Grant2RsuBatch::getNumGrants() const
+{
+    return this->numGrants;
+}
+
+void Grant2RsuBatch::setNumGrants(int numGrants)
+{
+    handleChange();
+    this->numGrants = numGrants;
+}
+
+class Grant2RsuBatchDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertyNames;
+    enum FieldConstants {
+        FIELD_batchId,
+        FIELD_processGnbId,
+        FIELD_numGrants,
+    };
+  public:
+    Grant2RsuBatchDescriptor();
+    virtual ~Grant2RsuBatchDescriptor();
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyName) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyName) const override;
+    virtual int getFieldArraySize(omnetpp::any_ptr object, int field) const override;
+    virtual void setFieldArraySize(omnetpp::any_ptr object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const override;
+    virtual omnetpp::cValue getFieldValue(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual omnetpp::any_ptr getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const override;
+};
+
+Register_ClassDescriptor(Grant2RsuBatchDescriptor)
+
+Grant2RsuBatchDescriptor::Grant2RsuBatchDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(Grant2RsuBatch)), "inet::FieldsChunk")
+{
+    propertyNames = nullptr;
+}
+
+Grant2RsuBatchDescriptor::~Grant2RsuBatchDescriptor()
+{
+    delete[] propertyNames;
+}
+
+bool Grant2RsuBatchDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<Grant2RsuBatch *>(obj)!=nullptr;
+}
+
+const char **Grant2RsuBatchDescriptor::getPropertyNames() const
+{
+    if (!propertyNames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+        const char **baseNames = base ? base->getPropertyNames() : nullptr;
+        propertyNames = mergeLists(baseNames, names);
+    }
+    return propertyNames;
+}
+
+const char *Grant2RsuBatchDescriptor::getProperty(const char *propertyName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    return base ? base->getProperty(propertyName) : nullptr;
+}
+
+int Grant2RsuBatchDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    return base ? 3+base->getFieldCount() : 3;
+}
+
+unsigned int Grant2RsuBatchDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldTypeFlags(field);
+        field -= base->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISEDITABLE,    // FIELD_batchId
+        FD_ISEDITABLE,    // FIELD_processGnbId
+        FD_ISEDITABLE,    // FIELD_numGrants
+    };
+    return (field >= 0 && field < 3) ? fieldTypeFlags[field] : 0;
+}
+
+const char *Grant2RsuBatchDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldName(field);
+        field -= base->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "batchId",
+        "processGnbId",
+        "numGrants",
+    };
+    return (field >= 0 && field < 3) ? fieldNames[field] : nullptr;
+}
+
+int Grant2RsuBatchDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    int baseIndex = base ? base->getFieldCount() : 0;
+    if (strcmp(fieldName, "batchId") == 0) return baseIndex + 0;
+    if (strcmp(fieldName, "processGnbId") == 0) return baseIndex + 1;
+    if (strcmp(fieldName, "numGrants") == 0) return baseIndex + 2;
+    return base ? base->findField(fieldName) : -1;
+}
+
+const char *Grant2RsuBatchDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldTypeString(field);
+        field -= base->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "unsigned int",    // FIELD_batchId
+        "unsigned short",    // FIELD_processGnbId
+        "int",    // FIELD_numGrants
+    };
+    return (field >= 0 && field < 3) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **Grant2RsuBatchDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldPropertyNames(field);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+const char *Grant2RsuBatchDescriptor::getFieldProperty(int field, const char *propertyName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldProperty(field, propertyName);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+int Grant2RsuBatchDescriptor::getFieldArraySize(omnetpp::any_ptr object, int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldArraySize(object, field);
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        default: return 0;
+    }
+}
+
+void Grant2RsuBatchDescriptor::setFieldArraySize(omnetpp::any_ptr object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'Grant2RsuBatch'", field);
+    }
+}
+
+const char *Grant2RsuBatchDescriptor::getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldDynamicTypeString(object,field,i);
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+std::string Grant2RsuBatchDescriptor::getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldValueAsString(object,field,i);
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_batchId: return ulong2string(pp->getBatchId());
+        case FIELD_processGnbId: return ulong2string(pp->getProcessGnbId());
+        case FIELD_numGrants: return long2string(pp->getNumGrants());
+        default: return "";
+    }
+}
+
+void Grant2RsuBatchDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_batchId: pp->setBatchId(string2ulong(value)); break;
+        case FIELD_processGnbId: pp->setProcessGnbId(string2ulong(value)); break;
+        case FIELD_numGrants: pp->setNumGrants(string2long(value)); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Grant2RsuBatch'", field);
+    }
+}
+
+omnetpp::cValue Grant2RsuBatchDescriptor::getFieldValue(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldValue(object,field,i);
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_batchId: return (omnetpp::intval_t)(pp->getBatchId());
+        case FIELD_processGnbId: return (omnetpp::intval_t)(pp->getProcessGnbId());
+        case FIELD_numGrants: return pp->getNumGrants();
+        default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'Grant2RsuBatch' as cValue -- field index out of range?", field);
+    }
+}
+
+void Grant2RsuBatchDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldValue(object, field, i, value);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_batchId: pp->setBatchId(omnetpp::checked_int_cast<unsigned int>(value.intValue())); break;
+        case FIELD_processGnbId: pp->setProcessGnbId(omnetpp::checked_int_cast<unsigned short>(value.intValue())); break;
+        case FIELD_numGrants: pp->setNumGrants(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Grant2RsuBatch'", field);
+    }
+}
+
+const char *Grant2RsuBatchDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldStructName(field);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    };
+}
+
+omnetpp::any_ptr Grant2RsuBatchDescriptor::getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldStructValuePointer(object, field, i);
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        default: return omnetpp::any_ptr(nullptr);
+    }
+}
+
+void Grant2RsuBatchDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    Grant2RsuBatch *pp = omnetpp::fromAnyPtr<Grant2RsuBatch>(object); (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'Grant2RsuBatch'", field);
+    }
+}
+
 namespace omnetpp {
 
 }  // namespace omnetpp
@@ -17,6 +17,7 @@
 #endif
 
 class Grant2Rsu;
+class Grant2RsuBatch;
 #include "inet/common/INETDefs_m.h" // import inet.common.INETDefs
 
 #include "inet/common/packet/chunk/Chunk_m.h" // import inet.common.packet.chunk.Chunk
@@ -139,10 +140,59 @@ class Grant2Rsu : public ::inet::FieldsChunk
 inline void doParsimPacking(omnetpp::cCommBuffer *b, const Grant2Rsu& obj) {obj.parsimPack(b);}
 inline void doParsimUnpacking(omnetpp::cCommBuffer *b, Grant2Rsu& obj) {obj.parsimUnpack(b);}
 
+/**
+ * Class generated from <tt>mecrt/packets/apps/Grant2Rsu.msg:47</tt> by opp_msgtool.
+ * <pre>
+ * class Grant2RsuBatch extends inet::FieldsChunk
+ * {
+ * 	unsigned int batchId;			// the batch id assigned by the scheduler, 4 bytes
+ * 	unsigned short processGnbId;	// the gNB id of processing gNB, 2 bytes
+ * 	int numGrants;					// the number of Grant2Rsu chunks in the batch, 4 bytes
+ * 
+ * 	chunkLength = inet::B(10);
+ * }
+ * </pre>
+ */
+class Grant2RsuBatch : public ::inet::FieldsChunk
+{
+  protected:
+    unsigned int batchId = 0;
+    unsigned short processGnbId = 0;
+    int numGrants = 0;
+
+  private:
+    void copy(const Grant2RsuBatch& other);
+
+  protected:
+    bool operator==(const Grant2RsuBatch&) = delete;
+
+  public:
+    Grant2RsuBatch();
+    Grant2RsuBatch(const Grant2RsuBatch& other);
+    virtual ~Grant2RsuBatch();
+    Grant2RsuBatch& operator=(const Grant2RsuBatch& other);
+    virtual Grant2RsuBatch *dup() const override {return new Grant2RsuBatch(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    virtual unsigned int getBatchId() const;
+    virtual void setBatchId(unsigned int batchId);
+
+    virtual unsigned short getProcessGnbId() const;
+    virtual void setProcessGnbId(unsigned short processGnbId);
+
+    virtual int getNumGrants() const;
+    virtual void setNumGrants(int numGrants);
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const Grant2RsuBatch& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, Grant2RsuBatch& obj) {obj.parsimUnpack(b);}
+
 
 namespace omnetpp {
 
 template<> inline Grant2Rsu *fromAnyPtr(any_ptr ptr) { return check_and_cast<Grant2Rsu*>(ptr.get<cObject>()); }
+template<> inline Grant2RsuBatch *fromAnyPtr(any_ptr ptr) { return check_and_cast<Grant2RsuBatch*>(ptr.get<cObject>()); }
 
 }  // namespace omnetpp
 
@@ -804,6 +804,907 @@ void RsuFeedbackDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object,
     }
 }
 
+Register_Class(RsuFeedbackBatch)
+
+RsuFeedbackBatch::RsuFeedbackBatch() : ::inet::FieldsChunk()
+{
+    this->setChunkLength(inet::B(56));
+
+}
+
+RsuFeedbackBatch::RsuFeedbackBatch(const RsuFeedbackBatch& other) : ::inet::FieldsChunk(other)
+{
+    copy(other);
+}
+
+RsuFeedbackBatch::~RsuFeedbackBatch()
+{
+    delete [] this->vehId;
+    delete [] this->bytePerBand;
+    delete [] this->rateUpdateTime;
+}
+
+RsuFeedbackBatch& RsuFeedbackBatch::operator=(const RsuFeedbackBatch& other)
+{
+    if (this == &other) return *this;
+    ::inet::FieldsChunk::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void RsuFeedbackBatch::copy(const RsuFeedbackBatch& other)
+{
+    this->gnbId = other.gnbId;
+    this->serverPort = other.serverPort;
+    this->frequency = other.frequency;
+    this->availBands = other.availBands;
+    this->totalBands = other.totalBands;
+    this->rsuAddr = other.rsuAddr;
+    this->bandUpdateTime = other.bandUpdateTime;
+    delete [] this->vehId;
+    this->vehId = (other.vehId_arraysize==0) ? nullptr : new int[other.vehId_arraysize];
+    vehId_arraysize = other.vehId_arraysize;
+    for (size_t i = 0; i < vehId_arraysize; i++) {
+        this->vehId[i] = other.vehId[i];
+    }
+    delete [] this->bytePerBand;
+    this->bytePerBand = (other.bytePerBand_arraysize==0) ? nullptr : new int[other.bytePerBand_arraysize];
+    bytePerBand_arraysize = other.bytePerBand_arraysize;
+    for (size_t i = 0; i < bytePerBand_arraysize; i++) {
+        this->bytePerBand[i] = other.bytePerBand[i];
+    }
+    delete [] this->rateUpdateTime;
+    this->rateUpdateTime = (other.rateUpdateTime_arraysize==0) ? nullptr : new omnetpp::simtime_t[other.rateUpdateTime_arraysize];
+    rateUpdateTime_arraysize = other.rateUpdateTime_arraysize;
+    for (size_t i = 0; i < rateUpdateTime_arraysize; i++) {
+        this->rateUpdateTime[i] = other.rateUpdateTime[i];
+    }
+    this->freeCmpUnits = other.freeCmpUnits;
+    this->totalCmpUnits = other.totalCmpUnits;
+    this->deviceType = other.deviceType;
+    this->resourceType = other.resourceType;
+    this->cmpUnitUpdateTime = other.cmpUnitUpdateTime;
+}
+
+void RsuFeedbackBatch::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    ::inet::FieldsChunk::parsimPack(b);
+    doParsimPacking(b,this->gnbId);
+    doParsimPacking(b,this->serverPort);
+    doParsimPacking(b,this->frequency);
+    doParsimPacking(b,this->availBands);
+    doParsimPacking(b,this->totalBands);
+    doParsimPacking(b,this->rsuAddr);
+    doParsimPacking(b,this->bandUpdateTime);
+    b->pack(vehId_arraysize);
+    doParsimArrayPacking(b,this->vehId,vehId_arraysize);
+    b->pack(bytePerBand_arraysize);
+    doParsimArrayPacking(b,this->bytePerBand,bytePerBand_arraysize);
+    b->pack(rateUpdateTime_arraysize);
+    doParsimArrayPacking(b,this->rateUpdateTime,rateUpdateTime_arraysize);
+    doParsimPacking(b,this->freeCmpUnits);
+    doParsimPacking(b,this->totalCmpUnits);
+    doParsimPacking(b,this->deviceType);
+    doParsimPacking(b,this->resourceType);
+    doParsimPacking(b,this->cmpUnitUpdateTime);
+}
+
+void RsuFeedbackBatch::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    ::inet::FieldsChunk::parsimUnpack(b);
+    doParsimUnpacking(b,this->gnbId);
+    doParsimUnpacking(b,this->serverPort);
+    doParsimUnpacking(b,this->frequency);
+    doParsimUnpacking(b,this->availBands);
+    doParsimUnpacking(b,this->totalBands);
+    doParsimUnpacking(b,this->rsuAddr);
+    doParsimUnpacking(b,this->bandUpdateTime);
+    delete [] this->vehId;
+    b->unpack(vehId_arraysize);
+    if (vehId_arraysize == 0) {
+        this->vehId = nullptr;
+    } else {
+        this->vehId = new int[vehId_arraysize];
+        doParsimArrayUnpacking(b,this->vehId,vehId_arraysize);
+    }
+    delete [] this->bytePerBand;
+    b->unpack(bytePerBand_arraysize);
+    if (bytePerBand_arraysize == 0) {
+        this->bytePerBand = nullptr;
+    } else {
+        this->bytePerBand = new int[bytePerBand_arraysize];
+        doParsimArrayUnpacking(b,this->bytePerBand,bytePerBand_arraysize);
+    }
+    delete [] this->rateUpdateTime;
+    b->unpack(rateUpdateTime_arraysize);
+    if (rateUpdateTime_arraysize == 0) {
+        this->rateUpdateTime = nullptr;
+    } else {
+        this->rateUpdateTime = new omnetpp::simtime_t[rateUpdateTime_arraysize];
+        doParsimArrayUnpacking(b,this->rateUpdateTime,rateUpdateTime_arraysize);
+    }
+    doParsimUnpacking(b,this->freeCmpUnits);
+    doParsimUnpacking(b,this->totalCmpUnits);
+    doParsimUnpacking(b,this->deviceType);
+    doParsimUnpacking(b,this->resourceType);
+    doParsimUnpacking(b,this->cmpUnitUpdateTime);
+}
+
+int RsuFeedbackBatch::getGnbId() const
+{
+    return this->gnbId;
+}
+
+void RsuFeedbackBatch::setGnbId(int gnbId)
+{
+    handleChange();
+    this->gnbId = gnbId;
+}
+
+int RsuFeedbackBatch::getServerPort() const
+{
+    return this->serverPort;
+}
+
+void RsuFeedbackBatch::setServerPort(int serverPort)
+{
+    handleChange();
+    this->serverPort = serverPort;
+}
+
+double RsuFeedbackBatch::getFrequency() const
+{
+    return this->frequency;
+}
+
+void RsuFeedbackBatch::setFrequency(double frequency)
+{
+    handleChange();
+    this->frequency = frequency;
+}
+
+int RsuFeedbackBatch::getAvailBands() const
+{
+    return this->availBands;
+}
+
+void RsuFeedbackBatch::setAvailBands(int availBands)
+{
+    handleChange();
+    this->availBands = availBands;
+}
+
+int RsuFeedbackBatch::getTotalBands() const
+{
+    return this->totalBands;
+}
+
+void RsuFeedbackBatch::setTotalBands(int totalBands)
+{
+    handleChange();
+    this->totalBands = totalBands;
+}
+
+uint32_t RsuFeedbackBatch::getRsuAddr() const
+{
+    return this->rsuAddr;
+}
+
+void RsuFeedbackBatch::setRsuAddr(uint32_t rsuAddr)
+{
+    handleChange();
+    this->rsuAddr = rsuAddr;
+}
+
+omnetpp::simtime_t RsuFeedbackBatch::getBandUpdateTime() const
+{
+    return this->bandUpdateTime;
+}
+
+void RsuFeedbackBatch::setBandUpdateTime(omnetpp::simtime_t bandUpdateTime)
+{
+    handleChange();
+    this->bandUpdateTime = bandUpdateTime;
+}
+
+size_t RsuFeedbackBatch::getVehIdArraySize() const
+{
+    return vehId_arraysize;
+}
+
+int RsuFeedbackBatch::getVehId(size_t k) const
+{
+    if (k >= vehId_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)vehId_arraysize, (unsigned long)k);
+    return this->vehId[k];
+}
+
+void RsuFeedbackBatch::setVehIdArraySize(size_t newSize)
+{
+    handleChange();
+    int *vehId2 = (newSize==0) ? nullptr : new int[newSize];
+    size_t minSize = vehId_arraysize < newSize ? vehId_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        vehId2[i] = this->vehId[i];
+    for (size_t i = minSize; i < newSize; i++)
+        vehId2[i] = 0;
+    delete [] this->vehId;
+    this->vehId = vehId2;
+    vehId_arraysize = newSize;
+}
+
+void RsuFeedbackBatch::setVehId(size_t k, int vehId)
+{
+    if (k >= vehId_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)vehId_arraysize, (unsigned long)k);
+    handleChange();
+    this->vehId[k] = vehId;
+}
+
+void RsuFeedbackBatch::insertVehId(size_t k, int vehId)
+{
+    if (k > vehId_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)vehId_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = vehId_arraysize + 1;
+    int *vehId2 = new int[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        vehId2[i] = this->vehId[i];
+    vehId2[k] = vehId;
+    for (i = k + 1; i < newSize; i++)
+        vehId2[i] = this->vehId[i-1];
+    delete [] this->vehId;
+    this->vehId = vehId2;
+    vehId_arraysize = newSize;
+}
+
+void RsuFeedbackBatch::appendVehId(int vehId)
+{
+    insertVehId(vehId_arraysize, vehId);
+}
+
+void RsuFeedbackBatch::eraseVehId(size_t k)
+{
+    if (k >= vehId_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)vehId_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = vehId_arraysize - 1;
+    int *vehId2 = (newSize == 0) ? nullptr : new int[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        vehId2[i] = this->vehId[i];
+    for (i = k; i < newSize; i++)
+        vehId2[i] = this->vehId[i+1];
+    delete [] this->vehId;
+    this->vehId = vehId2;
+    vehId_arraysize = newSize;
+}
+
+size_t RsuFeedbackBatch::getBytePerBandArraySize() const
+{
+    return bytePerBand_arraysize;
+}
+
+int RsuFeedbackBatch::getBytePerBand(size_t k) const
+{
+    if (k >= bytePerBand_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)bytePerBand_arraysize, (unsigned long)k);
+    return this->bytePerBand[k];
+}
+
+void RsuFeedbackBatch::setBytePerBandArraySize(size_t newSize)
+{
+    handleChange();
+    int *bytePerBand2 = (newSize==0) ? nullptr : new int[newSize];
+    size_t minSize = bytePerBand_arraysize < newSize ? bytePerBand_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        bytePerBand2[i] = this->bytePerBand[i];
+    for (size_t i = minSize; i < newSize; i++)
+        bytePerBand2[i] = 0;
+    delete [] this->bytePerBand;
+    this->bytePerBand = bytePerBand2;
+    bytePerBand_arraysize = newSize;
+}
+
+void RsuFeedbackBatch::setBytePerBand(size_t k, int bytePerBand)
+{
+    if (k >= bytePerBand_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)bytePerBand_arraysize, (unsigned long)k);
+    handleChange();
+    this->bytePerBand[k] = bytePerBand;
+}
+
+void RsuFeedbackBatch::insertBytePerBand(size_t k, int bytePerBand)
+{
+    if (k > bytePerBand_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)bytePerBand_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = bytePerBand_arraysize + 1;
+    int *bytePerBand2 = new int[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        bytePerBand2[i] = this->bytePerBand[i];
+    bytePerBand2[k] = bytePerBand;
+    for (i = k + 1; i < newSize; i++)
+        bytePerBand2[i] = this->bytePerBand[i-1];
+    delete [] this->bytePerBand;
+    this->bytePerBand = bytePerBand2;
+    bytePerBand_arraysize = newSize;
+}
+
+void RsuFeedbackBatch::appendBytePerBand(int bytePerBand)
+{
+    insertBytePerBand(bytePerBand_arraysize, bytePerBand);
+}
+
+void RsuFeedbackBatch::eraseBytePerBand(size_t k)
+{
+    if (k >= bytePerBand_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)bytePerBand_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = bytePerBand_arraysize - 1;
+    int *bytePerBand2 = (newSize == 0) ? nullptr : new int[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        bytePerBand2[i] = this->bytePerBand[i];
+    for (i = k; i < newSize; i++)
+        bytePerBand2[i] = this->bytePerBand[i+1];
+    delete [] this->bytePerBand;
+    this->bytePerBand = bytePerBand2;
+    bytePerBand_arraysize = newSize;
+}
+
+size_t RsuFeedbackBatch::getRateUpdateTimeArraySize() const
+{
+    return rateUpdateTime_arraysize;
+}
+
+omnetpp::simtime_t RsuFeedbackBatch::getRateUpdateTime(size_t k) const
+{
+    if (k >= rateUpdateTime_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)rateUpdateTime_arraysize, (unsigned long)k);
+    return this->rateUpdateTime[k];
+}
+
+void RsuFeedbackBatch::setRateUpdateTimeArraySize(size_t newSize)
+{
+    handleChange();
+    omnetpp::simtime_t *rateUpdateTime2 = (newSize==0) ? nullptr : new omnetpp::simtime_t[newSize];
+    size_t minSize = rateUpdateTime_arraysize < newSize ? rateUpdateTime_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        rateUpdateTime2[i] = this->rateUpdateTime[i];
+    for (size_t i = minSize; i < newSize; i++)
+        rateUpdateTime2[i] = SIMTIME_ZERO;
+    delete [] this->rateUpdateTime;
+    this->rateUpdateTime = rateUpdateTime2;
+    rateUpdateTime_arraysize = newSize;
+}
+
+void RsuFeedbackBatch::setRateUpdateTime(size_t k, omnetpp::simtime_t rateUpdateTime)
+{
+    if (k >= rateUpdateTime_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)rateUpdateTime_arraysize, (unsigned long)k);
+    handleChange();
+    this->rateUpdateTime[k] = rateUpdateTime;
+}
+
+void RsuFeedbackBatch::insertRateUpdateTime(size_t k, omnetpp::simtime_t rateUpdateTime)
+{
+    if (k > rateUpdateTime_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)rateUpdateTime_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = rateUpdateTime_arraysize + 1;
+    omnetpp::simtime_t *rateUpdateTime2 = new omnetpp::simtime_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        rateUpdateTime2[i] = this->rateUpdateTime[i];
+    rateUpdateTime2[k] = rateUpdateTime;
+    for (i = k + 1; i < newSize; i++)
+        rateUpdateTime2[i] = this->rateUpdateTime[i-1];
+    delete [] this->rateUpdateTime;
+    this->rateUpdateTime = rateUpdateTime2;
+    rateUpdateTime_arraysize = newSize;
+}
+
+void RsuFeedbackBatch::appendRateUpdateTime(omnetpp::simtime_t rateUpdateTime)
+{
+    insertRateUpdateTime(rateUpdateTime_arraysize, rateUpdateTime);
+}
+
+void RsuFeedbackBatch::eraseRateUpdateTime(size_t k)
+{
+    if (k >= rateUpdateTime_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)rateUpdateTime_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = rateUpdateTime_arraysize - 1;
+    omnetpp::simtime_t *rateUpdateTime2 = (newSize == 0) ? nullptr : new omnetpp::simtime_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        rateUpdateTime2[i] = this->rateUpdateTime[i];
+    for (i = k; i < newSize; i++)
+        rateUpdateTime2[i] = this->rateUpdateTime[i+1];
+    delete [] this->rateUpdateTime;
+    this->rateUpdateTime = rateUpdateTime2;
+    rateUpdateTime_arraysize = newSize;
+}
+
+int RsuFeedbackBatch::getFreeCmpUnits() const
+{
+    return this->freeCmpUnits;
+}
+
+void RsuFeedbackBatch::setFreeCmpUnits(int freeCmpUnits)
+{
+    handleChange();
+    this->freeCmpUnits = freeCmpUnits;
+}
+
+int RsuFeedbackBatch::getTotalCmpUnits() const
+{
+    return this->totalCmpUnits;
+}
+
+void RsuFeedbackBatch::setTotalCmpUnits(int totalCmpUnits)
+{
+    handleChange();
+    this->totalCmpUnits = totalCmpUnits;
+}
+
+const char * RsuFeedbackBatch::getDeviceType() const
+{
+    return this->deviceType.c_str();
+}
+
+void RsuFeedbackBatch::setDeviceType(const char * deviceType)
+{
+    handleChange();
+    this->deviceType = deviceType;
+}
+
+const char * RsuFeedbackBatch::getResourceType() const
+{
+    return this->resourceType.c_str();
+}
+
+void RsuFeedbackBatch::setResourceType(const char * resourceType)
+{
+    handleChange();
+    this->resourceType = resourceType;
+}
+
+omnetpp::simtime_t RsuFeedbackBatch::getCmpUnitUpdateTime() const
+{
+    return this->cmpUnitUpdateTime;
+}
+
+void RsuFeedbackBatch::setCmpUnitUpdateTime(omnetpp::simtime_t cmpUnitUpdateTime)
+{
+    handleChange();
+    this->cmpUnitUpdateTime = cmpUnitUpdateTime;
+}
+
+class RsuFeedbackBatchDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertyNames;
+    enum FieldConstants {
+        FIELD_gnbId,
+        FIELD_serverPort,
+        FIELD_frequency,
+        FIELD_availBands,
+        FIELD_totalBands,
+        FIELD_rsuAddr,
+        FIELD_bandUpdateTime,
+        FIELD_vehId,
+        FIELD_bytePerBand,
+        FIELD_rateUpdateTime,
+        FIELD_freeCmpUnits,
+        FIELD_totalCmpUnits,
+        FIELD_deviceType,
+        FIELD_resourceType,
+        FIELD_cmpUnitUpdateTime,
+    };
+  public:
+    RsuFeedbackBatchDescriptor();
+    virtual ~RsuFeedbackBatchDescriptor();
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyName) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyName) const override;
+    virtual int getFieldArraySize(omnetpp::any_ptr object, int field) const override;
+    virtual void setFieldArraySize(omnetpp::any_ptr object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const override;
+    virtual omnetpp::cValue getFieldValue(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual omnetpp::any_ptr getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const override;
+};
+
+Register_ClassDescriptor(RsuFeedbackBatchDescriptor)
+
+RsuFeedbackBatchDescriptor::RsuFeedbackBatchDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(RsuFeedbackBatch)), "inet::FieldsChunk")
+{
+    propertyNames = nullptr;
+}
+
+RsuFeedbackBatchDescriptor::~RsuFeedbackBatchDescriptor()
+{
+    delete[] propertyNames;
+}
+
+bool RsuFeedbackBatchDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<RsuFeedbackBatch *>(obj)!=nullptr;
+}
+
+const char **RsuFeedbackBatchDescriptor::getPropertyNames() const
+{
+    if (!propertyNames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+        const char **baseNames = base ? base->getPropertyNames() : nullptr;
+        propertyNames = mergeLists(baseNames, names);
+    }
+    return propertyNames;
+}
+
+const char *RsuFeedbackBatchDescriptor::getProperty(const char *propertyName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    return base ? base->getProperty(propertyName) : nullptr;
+}
+
+int RsuFeedbackBatchDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    return base ? 15+base->getFieldCount() : 15;
+}
+
+unsigned int RsuFeedbackBatchDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldTypeFlags(field);
+        field -= base->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISEDITABLE,    // FIELD_gnbId
+        FD_ISEDITABLE,    // FIELD_serverPort
+        FD_ISEDITABLE,    // FIELD_frequency
+        FD_ISEDITABLE,    // FIELD_availBands
+        FD_ISEDITABLE,    // FIELD_totalBands
+        FD_ISEDITABLE,    // FIELD_rsuAddr
+        FD_ISEDITABLE,    // FIELD_bandUpdateTime
+        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_vehId
+        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_bytePerBand
+        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_rateUpdateTime
+        FD_ISEDITABLE,    // FIELD_freeCmpUnits
+        FD_ISEDITABLE,    // FIELD_totalCmpUnits
+        FD_ISEDITABLE,    // FIELD_deviceType
+        FD_ISEDITABLE,    // FIELD_resourceType
+        FD_ISEDITABLE,    // FIELD_cmpUnitUpdateTime
+    };
+    return (field >= 0 && field < 15) ? fieldTypeFlags[field] : 0;
+}
+
+const char *RsuFeedbackBatchDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldName(field);
+        field -= base->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "gnbId",
+        "serverPort",
+        "frequency",
+        "availBands",
+        "totalBands",
+        "rsuAddr",
+        "bandUpdateTime",
+        "vehId",
+        "bytePerBand",
+        "rateUpdateTime",
+        "freeCmpUnits",
+        "totalCmpUnits",
+        "deviceType",
+        "resourceType",
+        "cmpUnitUpdateTime",
+    };
+    return (field >= 0 && field < 15) ? fieldNames[field] : nullptr;
+}
+
+int RsuFeedbackBatchDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    int baseIndex = base ? base->getFieldCount() : 0;
+    if (strcmp(fieldName, "gnbId") == 0) return baseIndex + 0;
+    if (strcmp(fieldName, "serverPort") == 0) return baseIndex + 1;
+    if (strcmp(fieldName, "frequency") == 0) return baseIndex + 2;
+    if (strcmp(fieldName, "availBands") == 0) return baseIndex + 3;
+    if (strcmp(fieldName, "totalBands") == 0) return baseIndex + 4;
+    if (strcmp(fieldName, "rsuAddr") == 0) return baseIndex + 5;
+    if (strcmp(fieldName, "bandUpdateTime") == 0) return baseIndex + 6;
+    if (strcmp(fieldName, "vehId") == 0) return baseIndex + 7;
+    if (strcmp(fieldName, "bytePerBand") == 0) return baseIndex + 8;
+    if (strcmp(fieldName, "rateUpdateTime") == 0) return baseIndex + 9;
+    if (strcmp(fieldName, "freeCmpUnits") == 0) return baseIndex + 10;
+    if (strcmp(fieldName, "totalCmpUnits") == 0) return baseIndex + 11;
+    if (strcmp(fieldName, "deviceType") == 0) return baseIndex + 12;
+    if (strcmp(fieldName, "resourceType") == 0) return baseIndex + 13;
+    if (strcmp(fieldName, "cmpUnitUpdateTime") == 0) return baseIndex + 14;
+    return base ? base->findField(fieldName) : -1;
+}
+
+const char *RsuFeedbackBatchDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldTypeString(field);
+        field -= base->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "int",    // FIELD_gnbId
+        "int",    // FIELD_serverPort
+        "double",    // FIELD_frequency
+        "int",    // FIELD_availBands
+        "int",    // FIELD_totalBands
+        "uint32",    // FIELD_rsuAddr
+        "omnetpp::simtime_t",    // FIELD_bandUpdateTime
+        "int",    // FIELD_vehId
+        "int",    // FIELD_bytePerBand
+        "omnetpp::simtime_t",    // FIELD_rateUpdateTime
+        "int",    // FIELD_freeCmpUnits
+        "int",    // FIELD_totalCmpUnits
+        "string",    // FIELD_deviceType
+        "string",    // FIELD_resourceType
+        "omnetpp::simtime_t",    // FIELD_cmpUnitUpdateTime
+    };
+    return (field >= 0 && field < 15) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **RsuFeedbackBatchDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldPropertyNames(field);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+const char *RsuFeedbackBatchDescriptor::getFieldProperty(int field, const char *propertyName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldProperty(field, propertyName);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+int RsuFeedbackBatchDescriptor::getFieldArraySize(omnetpp::any_ptr object, int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldArraySize(object, field);
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_vehId: return pp->getVehIdArraySize();
+        case FIELD_bytePerBand: return pp->getBytePerBandArraySize();
+        case FIELD_rateUpdateTime: return pp->getRateUpdateTimeArraySize();
+        default: return 0;
+    }
+}
+
+void RsuFeedbackBatchDescriptor::setFieldArraySize(omnetpp::any_ptr object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_vehId: pp->setVehIdArraySize(size); break;
+        case FIELD_bytePerBand: pp->setBytePerBandArraySize(size); break;
+        case FIELD_rateUpdateTime: pp->setRateUpdateTimeArraySize(size); break;
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'RsuFeedbackBatch'", field);
+    }
+}
+
+const char *RsuFeedbackBatchDescriptor::getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldDynamicTypeString(object,field,i);
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+std::string RsuFeedbackBatchDescriptor::getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldValueAsString(object,field,i);
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_gnbId: return long2string(pp->getGnbId());
+        case FIELD_serverPort: return long2string(pp->getServerPort());
+        case FIELD_frequency: return double2string(pp->getFrequency());
+        case FIELD_availBands: return long2string(pp->getAvailBands());
+        case FIELD_totalBands: return long2string(pp->getTotalBands());
+        case FIELD_rsuAddr: return ulong2string(pp->getRsuAddr());
+        case FIELD_bandUpdateTime: return simtime2string(pp->getBandUpdateTime());
+        case FIELD_vehId: return long2string(pp->getVehId(i));
+        case FIELD_bytePerBand: return long2string(pp->getBytePerBand(i));
+        case FIELD_rateUpdateTime: return simtime2string(pp->getRateUpdateTime(i));
+        case FIELD_freeCmpUnits: return long2string(pp->getFreeCmpUnits());
+        case FIELD_totalCmpUnits: return long2string(pp->getTotalCmpUnits());
+        case FIELD_deviceType: return oppstring2string(pp->getDeviceType());
+        case FIELD_resourceType: return oppstring2string(pp->getResourceType());
+        case FIELD_cmpUnitUpdateTime: return simtime2string(pp->getCmpUnitUpdateTime());
+        default: return "";
+    }
+}
+
+void RsuFeedbackBatchDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_gnbId: pp->setGnbId(string2long(value)); break;
+        case FIELD_serverPort: pp->setServerPort(string2long(value)); break;
+        case FIELD_frequency: pp->setFrequency(string2double(value)); break;
+        case FIELD_availBands: pp->setAvailBands(string2long(value)); break;
+        case FIELD_totalBands: pp->setTotalBands(string2long(value)); break;
+        case FIELD_rsuAddr: pp->setRsuAddr(string2ulong(value)); break;
+        case FIELD_bandUpdateTime: pp->setBandUpdateTime(string2simtime(value)); break;
+        case FIELD_vehId: pp->setVehId(i,string2long(value)); break;
+        case FIELD_bytePerBand: pp->setBytePerBand(i,string2long(value)); break;
+        case FIELD_rateUpdateTime: pp->setRateUpdateTime(i,string2simtime(value)); break;
+        case FIELD_freeCmpUnits: pp->setFreeCmpUnits(string2long(value)); break;
+        case FIELD_totalCmpUnits: pp->setTotalCmpUnits(string2long(value)); break;
+        case FIELD_deviceType: pp->setDeviceType((value)); break;
+        case FIELD_resourceType: pp->setResourceType((value)); break;
+        case FIELD_cmpUnitUpdateTime: pp->setCmpUnitUpdateTime(string2simtime(value)); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'RsuFeedbackBatch'", field);
+    }
+}
+
+omnetpp::cValue RsuFeedbackBatchDescriptor::getFieldValue(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldValue(object,field,i);
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_gnbId: return pp->getGnbId();
+        case FIELD_serverPort: return pp->getServerPort();
+        case FIELD_frequency: return pp->getFrequency();
+        case FIELD_availBands: return pp->getAvailBands();
+        case FIELD_totalBands: return pp->getTotalBands();
+        case FIELD_rsuAddr: return (omnetpp::intval_t)(pp->getRsuAddr());
+        case FIELD_bandUpdateTime: return pp->getBandUpdateTime().dbl();
+        case FIELD_vehId: return pp->getVehId(i);
+        case FIELD_bytePerBand: return pp->getBytePerBand(i);
+        case FIELD_rateUpdateTime: return pp->getRateUpdateTime(i).dbl();
+        case FIELD_freeCmpUnits: return pp->getFreeCmpUnits();
+        case FIELD_totalCmpUnits: return pp->getTotalCmpUnits();
+        case FIELD_deviceType: return pp->getDeviceType();
+        case FIELD_resourceType: return pp->getResourceType();
+        case FIELD_cmpUnitUpdateTime: return pp->getCmpUnitUpdateTime().dbl();
+        default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'RsuFeedbackBatch' as cValue -- field index out of range?", field);
+    }
+}
+
+void RsuFeedbackBatchDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldValue(object, field, i, value);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        case FIELD_gnbId: pp->setGnbId(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_serverPort: pp->setServerPort(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_frequency: pp->setFrequency(value.doubleValue()); break;
+        case FIELD_availBands: pp->setAvailBands(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_totalBands: pp->setTotalBands(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_rsuAddr: pp->setRsuAddr(omnetpp::checked_int_cast<uint32_t>(value.intValue())); break;
+        case FIELD_bandUpdateTime: pp->setBandUpdateTime(value.doubleValue()); break;
+        case FIELD_vehId: pp->setVehId(i,omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_bytePerBand: pp->setBytePerBand(i,omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_rateUpdateTime: pp->setRateUpdateTime(i,value.doubleValue()); break;
+        case FIELD_freeCmpUnits: pp->setFreeCmpUnits(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_totalCmpUnits: pp->setTotalCmpUnits(omnetpp::checked_int_cast<int>(value.intValue())); break;
+        case FIELD_deviceType: pp->setDeviceType(value.stringValue()); break;
+        case FIELD_resourceType: pp->setResourceType(value.stringValue()); break;
+        case FIELD_cmpUnitUpdateTime: pp->setCmpUnitUpdateTime(value.doubleValue()); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'RsuFeedbackBatch'", field);
+    }
+}
+
+const char *RsuFeedbackBatchDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldStructName(field);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    };
+}
+
+omnetpp::any_ptr RsuFeedbackBatchDescriptor::getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldStructValuePointer(object, field, i);
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        default: return omnetpp::any_ptr(nullptr);
+    }
+}
+
+void RsuFeedbackBatchDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    RsuFeedbackBatch *pp = omnetpp::fromAnyPtr<RsuFeedbackBatch>(object); (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'RsuFeedbackBatch'", field);
+    }
+}
+
 namespace omnetpp {
 
 }  // namespace omnetpp
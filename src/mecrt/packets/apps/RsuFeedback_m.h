@@ -17,6 +17,7 @@
 #endif
 
 class RsuFeedback;
+class RsuFeedbackBatch;
 #include "inet/common/INETDefs_m.h" // import inet.common.INETDefs
 
 #include "inet/common/packet/chunk/Chunk_m.h" // import inet.common.packet.chunk.Chunk
@@ -128,10 +129,142 @@ class RsuFeedback : public ::inet::FieldsChunk
 inline void doParsimPacking(omnetpp::cCommBuffer *b, const RsuFeedback& obj) {obj.parsimPack(b);}
 inline void doParsimUnpacking(omnetpp::cCommBuffer *b, RsuFeedback& obj) {obj.parsimUnpack(b);}
 
+/**
+ * Class generated from <tt>mecrt/packets/apps/RsuFeedback.msg:46</tt> by opp_msgtool.
+ * <pre>
+ * class RsuFeedbackBatch extends inet::FieldsChunk {
+ *     // ===== specified in the gNB MAC stack ===========
+ *     int gnbId;	// MacNodeId of gNB, 4 bytes
+ *     int serverPort;	// the port id of the server app within the gNB, 4 bytes
+ *     double frequency;	// carrier frequency, 4 bytes
+ *     int availBands;	// number of bands, 4 bytes
+ *     int totalBands;	// total bands can be used for scheduling, 4 bytes
+ *     uint32 rsuAddr;	// the IPv4 address of the RSU, 4 bytes
+ *     simtime_t bandUpdateTime;	// the time when the bands were updated, 8 bytes
+ *     int vehId[];	// MacNodeId of each UE, 4 bytes each
+ *     int bytePerBand[];	// bytes that can be delived within 1 TTI for each band, for each UE, 4 bytes each
+ *     simtime_t rateUpdateTime[];	// the time when the data rate of each UE was measured, 8 bytes each
+ * 
+ *     // ===== specified in the server app of the gNB ===========
+ *     int freeCmpUnits;	// the available computing units in the RSU server, 4 bytes
+ *     int totalCmpUnits;	// total computing units in the RSU server, 4 bytes
+ *     string deviceType;	// the device type of the server (e.g., "RTX3090"), 4 bytes
+ *     string resourceType;	// the resource type of the server (e.g., "GPU"), 4 bytes
+ *     simtime_t cmpUnitUpdateTime;	// the time when the computing units were updated, 8 bytes
+ * 
+ *     chunkLength = inet::B(56);	// without the UE entries, 16 bytes are added for each UE
+ * }
+ * </pre>
+ */
+class RsuFeedbackBatch : public ::inet::FieldsChunk
+{
+  protected:
+    int gnbId = 0;
+    int serverPort = 0;
+    double frequency = 0;
+    int availBands = 0;
+    int totalBands = 0;
+    uint32_t rsuAddr = 0;
+    omnetpp::simtime_t bandUpdateTime = SIMTIME_ZERO;
+    int *vehId = nullptr;
+    size_t vehId_arraysize = 0;
+    int *bytePerBand = nullptr;
+    size_t bytePerBand_arraysize = 0;
+    omnetpp::simtime_t *rateUpdateTime = nullptr;
+    size_t rateUpdateTime_arraysize = 0;
+    int freeCmpUnits = 0;
+    int totalCmpUnits = 0;
+    omnetpp::opp_string deviceType;
+    omnetpp::opp_string resourceType;
+    omnetpp::simtime_t cmpUnitUpdateTime = SIMTIME_ZERO;
+
+  private:
+    void copy(const RsuFeedbackBatch& other);
+
+  protected:
+    bool operator==(const RsuFeedbackBatch&) = delete;
+
+  public:
+    RsuFeedbackBatch();
+    RsuFeedbackBatch(const RsuFeedbackBatch& other);
+    virtual ~RsuFeedbackBatch();
+    RsuFeedbackBatch& operator=(const RsuFeedbackBatch& other);
+    virtual RsuFeedbackBatch *dup() const override {return new RsuFeedbackBatch(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    virtual int getGnbId() const;
+    virtual void setGnbId(int gnbId);
+
+    virtual int getServerPort() const;
+    virtual void setServerPort(int serverPort);
+
+    virtual double getFrequency() const;
+    virtual void setFrequency(double frequency);
+
+    virtual int getAvailBands() const;
+    virtual void setAvailBands(int availBands);
+
+    virtual int getTotalBands() const;
+    virtual void setTotalBands(int totalBands);
+
+    virtual uint32_t getRsuAddr() const;
+    virtual void setRsuAddr(uint32_t rsuAddr);
+
+    virtual omnetpp::simtime_t getBandUpdateTime() const;
+    virtual void setBandUpdateTime(omnetpp::simtime_t bandUpdateTime);
+
+    virtual void setVehIdArraySize(size_t size);
+    virtual size_t getVehIdArraySize() const;
+    virtual int getVehId(size_t k) const;
+    virtual void setVehId(size_t k, int vehId);
+    virtual void insertVehId(size_t k, int vehId);
+    [[deprecated]] void insertVehId(int vehId) {appendVehId(vehId);}
+    virtual void appendVehId(int vehId);
+    virtual void eraseVehId(size_t k);
+
+    virtual void setBytePerBandArraySize(size_t size);
+    virtual size_t getBytePerBandArraySize() const;
+    virtual int getBytePerBand(size_t k) const;
+    virtual void setBytePerBand(size_t k, int bytePerBand);
+    virtual void insertBytePerBand(size_t k, int bytePerBand);
+    [[deprecated]] void insertBytePerBand(int bytePerBand) {appendBytePerBand(bytePerBand);}
+    virtual void appendBytePerBand(int bytePerBand);
+    virtual void eraseBytePerBand(size_t k);
+
+    virtual void setRateUpdateTimeArraySize(size_t size);
+    virtual size_t getRateUpdateTimeArraySize() const;
+    virtual omnetpp::simtime_t getRateUpdateTime(size_t k) const;
+    virtual void setRateUpdateTime(size_t k, omnetpp::simtime_t rateUpdateTime);
+    virtual void insertRateUpdateTime(size_t k, omnetpp::simtime_t rateUpdateTime);
+    [[deprecated]] void insertRateUpdateTime(omnetpp::simtime_t rateUpdateTime) {appendRateUpdateTime(rateUpdateTime);}
+    virtual void appendRateUpdateTime(omnetpp::simtime_t rateUpdateTime);
+    virtual void eraseRateUpdateTime(size_t k);
+
+    virtual int getFreeCmpUnits() const;
+    virtual void setFreeCmpUnits(int freeCmpUnits);
+
+    virtual int getTotalCmpUnits() const;
+    virtual void setTotalCmpUnits(int totalCmpUnits);
+
+    virtual const char * getDeviceType() const;
+    virtual void setDeviceType(const char * deviceType);
+
+    virtual const char * getResourceType() const;
+    virtual void setResourceType(const char * resourceType);
+
+    virtual omnetpp::simtime_t getCmpUnitUpdateTime() const;
+    virtual void setCmpUnitUpdateTime(omnetpp::simtime_t cmpUnitUpdateTime);
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const RsuFeedbackBatch& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, RsuFeedbackBatch& obj) {obj.parsimUnpack(b);}
+
 
 namespace omnetpp {
 
 template<> inline RsuFeedback *fromAnyPtr(any_ptr ptr) { return check_and_cast<RsuFeedback*>(ptr.get<cObject>()); }
+template<> inline RsuFeedbackBatch *fromAnyPtr(any_ptr ptr) { return check_and_cast<RsuFeedbackBatch*>(ptr.get<cObject>()); }
 
 }  // namespace omnetpp
 
@@ -679,6 +679,7 @@ void VecRequest::copy(const VecRequest& other)
     this->accuracy = other.accuracy;
     this->energy = other.energy;
     this->offloadPower = other.offloadPower;
+    this->hopCount = other.hopCount;
 }
 
 void VecRequest::parsimPack(omnetpp::cCommBuffer *b) const
@@ -695,6 +696,7 @@ void VecRequest::parsimPack(omnetpp::cCommBuffer *b) const
     doParsimPacking(b,this->accuracy);
     doParsimPacking(b,this->energy);
     doParsimPacking(b,this->offloadPower);
+    doParsimPacking(b,this->hopCount);
 }
 
 void VecRequest::parsimUnpack(omnetpp::cCommBuffer *b)
@@ -711,6 +713,7 @@ void VecRequest::parsimUnpack(omnetpp::cCommBuffer *b)
     doParsimUnpacking(b,this->accuracy);
     doParsimUnpacking(b,this->energy);
     doParsimUnpacking(b,this->offloadPower);
+    doParsimUnpacking(b,this->hopCount);
 }
 
 int VecRequest::getInputSize() const
@@ -834,6 +837,17 @@ void VecRequest::setOffloadPower(double offloadPower)
     this->offloadPower = offloadPower;
 }
 
+int VecRequest::getHopCount() const
+{
+    return this->hopCount;
+}
+
+void VecRequest::setHopCount(int hopCount)
+{
+    handleChange();
+    this->hopCount = hopCount;
+}
+
 class VecRequestDescriptor : public omnetpp::cClassDescriptor
 {
   private:
@@ -850,6 +864,7 @@ class VecRequestDescriptor : public omnetpp::cClassDescriptor
         FIELD_accuracy,
         FIELD_energy,
         FIELD_offloadPower,
+        FIELD_hopCount,
     };
   public:
     VecRequestDescriptor();
@@ -916,7 +931,7 @@ const char *VecRequestDescriptor::getProperty(const char *propertyName) const
 int VecRequestDescriptor::getFieldCount() const
 {
     omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    return base ? 11+base->getFieldCount() : 11;
+    return base ? 12+base->getFieldCount() : 12;
 }
 
 unsigned int VecRequestDescriptor::getFieldTypeFlags(int field) const
@@ -939,8 +954,9 @@ unsigned int VecRequestDescriptor::getFieldTypeFlags(int field) const
         FD_ISEDITABLE,    // FIELD_accuracy
         FD_ISEDITABLE,    // FIELD_energy
         FD_ISEDITABLE,    // FIELD_offloadPower
+        FD_ISEDITABLE,    // FIELD_hopCount
     };
-    return (field >= 0 && field < 11) ? fieldTypeFlags[field] : 0;
+    return (field >= 0 && field < 12) ? fieldTypeFlags[field] : 0;
 }
 
 const char *VecRequestDescriptor::getFieldName(int field) const
@@ -963,8 +979,9 @@ const char *VecRequestDescriptor::getFieldName(int field) const
         "accuracy",
         "energy",
         "offloadPower",
+        "hopCount",
     };
-    return (field >= 0 && field < 11) ? fieldNames[field] : nullptr;
+    return (field >= 0 && field < 12) ? fieldNames[field] : nullptr;
 }
 
 int VecRequestDescriptor::findField(const char *fieldName) const
@@ -982,6 +999,7 @@ int VecRequestDescriptor::findField(const char *fieldName) const
     if (strcmp(fieldName, "accuracy") == 0) return baseIndex + 8;
     if (strcmp(fieldName, "energy") == 0) return baseIndex + 9;
     if (strcmp(fieldName, "offloadPower") == 0) return baseIndex + 10;
+    if (strcmp(fieldName, "hopCount") == 0) return baseIndex + 11;
     return base ? base->findField(fieldName) : -1;
 }
 
@@ -1005,8 +1023,9 @@ const char *VecRequestDescriptor::getFieldTypeString(int field) const
         "double",    // FIELD_accuracy
         "double",    // FIELD_energy
         "double",    // FIELD_offloadPower
+        "int",    // FIELD_hopCount
     };
-    return (field >= 0 && field < 11) ? fieldTypeStrings[field] : nullptr;
+    return (field >= 0 && field < 12) ? fieldTypeStrings[field] : nullptr;
 }
 
 const char **VecRequestDescriptor::getFieldPropertyNames(int field) const
@@ -1100,6 +1119,7 @@ std::string VecRequestDescriptor::getFieldValueAsString(omnetpp::any_ptr object,
         case FIELD_accuracy: return double2string(pp->getAccuracy());
         case FIELD_energy: return double2string(pp->getEnergy());
         case FIELD_offloadPower: return double2string(pp->getOffloadPower());
+        case FIELD_hopCount: return long2string(pp->getHopCount());
         default: return "";
     }
 }
@@ -1127,6 +1147,7 @@ void VecRequestDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int fi
         case FIELD_accuracy: pp->setAccuracy(string2double(value)); break;
         case FIELD_energy: pp->setEnergy(string2double(value)); break;
         case FIELD_offloadPower: pp->setOffloadPower(string2double(value)); break;
+        case FIELD_hopCount: pp->setHopCount(string2long(value)); break;
         default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'VecRequest'", field);
     }
 }
@@ -1152,6 +1173,7 @@ omnetpp::cValue VecRequestDescriptor::getFieldValue(omnetpp::any_ptr object, int
         case FIELD_accuracy: return pp->getAccuracy();
         case FIELD_energy: return pp->getEnergy();
         case FIELD_offloadPower: return pp->getOffloadPower();
+        case FIELD_hopCount: return pp->getHopCount();
         default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'VecRequest' as cValue -- field index out of range?", field);
     }
 }
@@ -1179,6 +1201,7 @@ void VecRequestDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int
         case FIELD_accuracy: pp->setAccuracy(value.doubleValue()); break;
         case FIELD_energy: pp->setEnergy(value.doubleValue()); break;
         case FIELD_offloadPower: pp->setOffloadPower(value.doubleValue()); break;
+        case FIELD_hopCount: pp->setHopCount(omnetpp::checked_int_cast<int>(value.intValue())); break;
         default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'VecRequest'", field);
     }
 }
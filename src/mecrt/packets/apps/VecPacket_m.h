@@ -104,6 +104,7 @@ inline void doParsimUnpacking(omnetpp::cCommBuffer *b, JobPacket& obj) {obj.pars
  *     double accuracy;		// the accuracy requirement of the application, 4 bytes
  *     double energy;	// the energy consumed by processing an application locally
  *     double offloadPower;	// the offloading power of the Gnb
+ *     int hopCount = 0;		// backhaul hops travelled from the RSU that received it from the UE, backhaul bookkeeping not counted in the size
  *     chunkLength = inet::B(52); // total size: 52 bytes
  * }
  * </pre>
@@ -122,6 +123,7 @@ class VecRequest : public ::inet::FieldsChunk
     double accuracy = 0;
     double energy = 0;
     double offloadPower = 0;
+    int hopCount = 0;
 
   private:
     void copy(const VecRequest& other);
@@ -170,6 +172,9 @@ class VecRequest : public ::inet::FieldsChunk
 
     virtual double getOffloadPower() const;
     virtual void setOffloadPower(double offloadPower);
+
+    virtual int getHopCount() const;
+    virtual void setHopCount(int hopCount);
 };
 
 inline void doParsimPacking(omnetpp::cCommBuffer *b, const VecRequest& obj) {obj.parsimPack(b);}
@@ -154,7 +154,7 @@ Register_Class(OspfLsa)
 
 OspfLsa::OspfLsa() : ::inet::FieldsChunk()
 {
-    this->setChunkLength(inet::B(28));
+    this->setChunkLength(inet::B(25));
 
 }
 
@@ -195,6 +195,8 @@ void OspfLsa::copy(const OspfLsa& other)
     for (size_t i = 0; i < cost_arraysize; i++) {
         this->cost[i] = other.cost[i];
     }
+    this->isDelta_ = other.isDelta_;
+    this->baseSeqNum = other.baseSeqNum;
 }
 
 void OspfLsa::parsimPack(omnetpp::cCommBuffer *b) const
@@ -208,6 +210,8 @@ void OspfLsa::parsimPack(omnetpp::cCommBuffer *b) const
     doParsimArrayPacking(b,this->neighbor,neighbor_arraysize);
     b->pack(cost_arraysize);
     doParsimArrayPacking(b,this->cost,cost_arraysize);
+    doParsimPacking(b,this->isDelta_);
+    doParsimPacking(b,this->baseSeqNum);
 }
 
 void OspfLsa::parsimUnpack(omnetpp::cCommBuffer *b)
@@ -233,6 +237,8 @@ void OspfLsa::parsimUnpack(omnetpp::cCommBuffer *b)
         this->cost = new double[cost_arraysize];
         doParsimArrayUnpacking(b,this->cost,cost_arraysize);
     }
+    doParsimUnpacking(b,this->isDelta_);
+    doParsimUnpacking(b,this->baseSeqNum);
 }
 
 uint32_t OspfLsa::getOrigin() const
@@ -419,6 +425,28 @@ void OspfLsa::eraseCost(size_t k)
     cost_arraysize = newSize;
 }
 
+bool OspfLsa::isDelta() const
+{
+    return this->isDelta_;
+}
+
+void OspfLsa::setIsDelta(bool isDelta)
+{
+    handleChange();
+    this->isDelta_ = isDelta;
+}
+
+uint32_t OspfLsa::getBaseSeqNum() const
+{
+    return this->baseSeqNum;
+}
+
+void OspfLsa::setBaseSeqNum(uint32_t baseSeqNum)
+{
+    handleChange();
+    this->baseSeqNum = baseSeqNum;
+}
+
 class OspfLsaDescriptor : public omnetpp::cClassDescriptor
 {
   private:
@@ -430,6 +458,8 @@ class OspfLsaDescriptor : public omnetpp::cClassDescriptor
         FIELD_installTime,
         FIELD_neighbor,
         FIELD_cost,
+        FIELD_isDelta,
+        FIELD_baseSeqNum,
     };
   public:
     OspfLsaDescriptor();
@@ -496,7 +526,7 @@ const char *OspfLsaDescriptor::getProperty(const char *propertyName) const
 int OspfLsaDescriptor::getFieldCount() const
 {
     omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    return base ? 6+base->getFieldCount() : 6;
+    return base ? 8+base->getFieldCount() : 8;
 }
 
 unsigned int OspfLsaDescriptor::getFieldTypeFlags(int field) const
@@ -514,8 +544,10 @@ unsigned int OspfLsaDescriptor::getFieldTypeFlags(int field) const
         FD_ISEDITABLE,    // FIELD_installTime
         FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_neighbor
         FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_cost
+        FD_ISEDITABLE,    // FIELD_isDelta
+        FD_ISEDITABLE,    // FIELD_baseSeqNum
     };
-    return (field >= 0 && field < 6) ? fieldTypeFlags[field] : 0;
+    return (field >= 0 && field < 8) ? fieldTypeFlags[field] : 0;
 }
 
 const char *OspfLsaDescriptor::getFieldName(int field) const
@@ -533,8 +565,10 @@ const char *OspfLsaDescriptor::getFieldName(int field) const
         "installTime",
         "neighbor",
         "cost",
+        "isDelta",
+        "baseSeqNum",
     };
-    return (field >= 0 && field < 6) ? fieldNames[field] : nullptr;
+    return (field >= 0 && field < 8) ? fieldNames[field] : nullptr;
 }
 
 int OspfLsaDescriptor::findField(const char *fieldName) const
@@ -547,6 +581,8 @@ int OspfLsaDescriptor::findField(const char *fieldName) const
     if (strcmp(fieldName, "installTime") == 0) return baseIndex + 3;
     if (strcmp(fieldName, "neighbor") == 0) return baseIndex + 4;
     if (strcmp(fieldName, "cost") == 0) return baseIndex + 5;
+    if (strcmp(fieldName, "isDelta") == 0) return baseIndex + 6;
+    if (strcmp(fieldName, "baseSeqNum") == 0) return baseIndex + 7;
     return base ? base->findField(fieldName) : -1;
 }
 
@@ -565,8 +601,10 @@ const char *OspfLsaDescriptor::getFieldTypeString(int field) const
         "omnetpp::simtime_t",    // FIELD_installTime
         "uint32",    // FIELD_neighbor
         "double",    // FIELD_cost
+        "bool",    // FIELD_isDelta
+        "uint32",    // FIELD_baseSeqNum
     };
-    return (field >= 0 && field < 6) ? fieldTypeStrings[field] : nullptr;
+    return (field >= 0 && field < 8) ? fieldTypeStrings[field] : nullptr;
 }
 
 const char **OspfLsaDescriptor::getFieldPropertyNames(int field) const
@@ -659,6 +697,8 @@ std::string OspfLsaDescriptor::getFieldValueAsString(omnetpp::any_ptr object, in
         case FIELD_installTime: return simtime2string(pp->getInstallTime());
         case FIELD_neighbor: return ulong2string(pp->getNeighbor(i));
         case FIELD_cost: return double2string(pp->getCost(i));
+        case FIELD_isDelta: return bool2string(pp->isDelta());
+        case FIELD_baseSeqNum: return ulong2string(pp->getBaseSeqNum());
         default: return "";
     }
 }
@@ -681,6 +721,8 @@ void OspfLsaDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int field
         case FIELD_installTime: pp->setInstallTime(string2simtime(value)); break;
         case FIELD_neighbor: pp->setNeighbor(i,string2ulong(value)); break;
         case FIELD_cost: pp->setCost(i,string2double(value)); break;
+        case FIELD_isDelta: pp->setIsDelta(string2bool(value)); break;
+        case FIELD_baseSeqNum: pp->setBaseSeqNum(string2ulong(value)); break;
         default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'OspfLsa'", field);
     }
 }
@@ -701,6 +743,8 @@ omnetpp::cValue OspfLsaDescriptor::getFieldValue(omnetpp::any_ptr object, int fi
         case FIELD_installTime: return pp->getInstallTime().dbl();
         case FIELD_neighbor: return (omnetpp::intval_t)(pp->getNeighbor(i));
         case FIELD_cost: return pp->getCost(i);
+        case FIELD_isDelta: return pp->isDelta();
+        case FIELD_baseSeqNum: return (omnetpp::intval_t)(pp->getBaseSeqNum());
         default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'OspfLsa' as cValue -- field index out of range?", field);
     }
 }
@@ -723,6 +767,8 @@ void OspfLsaDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int i,
         case FIELD_installTime: pp->setInstallTime(value.doubleValue()); break;
         case FIELD_neighbor: pp->setNeighbor(i,omnetpp::checked_int_cast<uint32_t>(value.intValue())); break;
         case FIELD_cost: pp->setCost(i,value.doubleValue()); break;
+        case FIELD_isDelta: pp->setIsDelta(value.boolValue()); break;
+        case FIELD_baseSeqNum: pp->setBaseSeqNum(omnetpp::checked_int_cast<uint32_t>(value.intValue())); break;
         default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'OspfLsa'", field);
     }
 }
@@ -770,6 +816,631 @@ void OspfLsaDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, int
     }
 }
 
+Register_Class(OspfLsaAck)
+
+OspfLsaAck::OspfLsaAck() : ::inet::FieldsChunk()
+{
+    this->setChunkLength(inet::B(0));
+
+}
+
+OspfLsaAck::OspfLsaAck(const OspfLsaAck& other) : ::inet::FieldsChunk(other)
+{
+    copy(other);
+}
+
+OspfLsaAck::~OspfLsaAck()
+{
+    delete [] this->origin;
+    delete [] this->seqNum;
+    delete [] this->heldSeqNum;
+}
+
+OspfLsaAck& OspfLsaAck::operator=(const OspfLsaAck& other)
+{
+    if (this == &other) return *this;
+    ::inet::FieldsChunk::operator=(other);
+    copy(other);
+    return *this;
+}
+
+void OspfLsaAck::copy(const OspfLsaAck& other)
+{
+    delete [] this->origin;
+    this->origin = (other.origin_arraysize==0) ? nullptr : new uint32_t[other.origin_arraysize];
+    origin_arraysize = other.origin_arraysize;
+    for (size_t i = 0; i < origin_arraysize; i++) {
+        this->origin[i] = other.origin[i];
+    }
+    delete [] this->seqNum;
+    this->seqNum = (other.seqNum_arraysize==0) ? nullptr : new uint32_t[other.seqNum_arraysize];
+    seqNum_arraysize = other.seqNum_arraysize;
+    for (size_t i = 0; i < seqNum_arraysize; i++) {
+        this->seqNum[i] = other.seqNum[i];
+    }
+    delete [] this->heldSeqNum;
+    this->heldSeqNum = (other.heldSeqNum_arraysize==0) ? nullptr : new uint32_t[other.heldSeqNum_arraysize];
+    heldSeqNum_arraysize = other.heldSeqNum_arraysize;
+    for (size_t i = 0; i < heldSeqNum_arraysize; i++) {
+        this->heldSeqNum[i] = other.heldSeqNum[i];
+    }
+}
+
+void OspfLsaAck::parsimPack(omnetpp::cCommBuffer *b) const
+{
+    ::inet::FieldsChunk::parsimPack(b);
+    b->pack(origin_arraysize);
+    doParsimArrayPacking(b,this->origin,origin_arraysize);
+    b->pack(seqNum_arraysize);
+    doParsimArrayPacking(b,this->seqNum,seqNum_arraysize);
+    b->pack(heldSeqNum_arraysize);
+    doParsimArrayPacking(b,this->heldSeqNum,heldSeqNum_arraysize);
+}
+
+void OspfLsaAck::parsimUnpack(omnetpp::cCommBuffer *b)
+{
+    ::inet::FieldsChunk::parsimUnpack(b);
+    delete [] this->origin;
+    b->unpack(origin_arraysize);
+    if (origin_arraysize == 0) {
+        this->origin = nullptr;
+    } else {
+        this->origin = new uint32_t[origin_arraysize];
+        doParsimArrayUnpacking(b,this->origin,origin_arraysize);
+    }
+    delete [] this->seqNum;
+    b->unpack(seqNum_arraysize);
+    if (seqNum_arraysize == 0) {
+        this->seqNum = nullptr;
+    } else {
+        this->seqNum = new uint32_t[seqNum_arraysize];
+        doParsimArrayUnpacking(b,this->seqNum,seqNum_arraysize);
+    }
+    delete [] this->heldSeqNum;
+    b->unpack(heldSeqNum_arraysize);
+    if (heldSeqNum_arraysize == 0) {
+        this->heldSeqNum = nullptr;
+    } else {
+        this->heldSeqNum = new uint32_t[heldSeqNum_arraysize];
+        doParsimArrayUnpacking(b,this->heldSeqNum,heldSeqNum_arraysize);
+    }
+}
+
+size_t OspfLsaAck::getOriginArraySize() const
+{
+    return origin_arraysize;
+}
+
+uint32_t OspfLsaAck::getOrigin(size_t k) const
+{
+    if (k >= origin_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)origin_arraysize, (unsigned long)k);
+    return this->origin[k];
+}
+
+void OspfLsaAck::setOriginArraySize(size_t newSize)
+{
+    handleChange();
+    uint32_t *origin2 = (newSize==0) ? nullptr : new uint32_t[newSize];
+    size_t minSize = origin_arraysize < newSize ? origin_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        origin2[i] = this->origin[i];
+    for (size_t i = minSize; i < newSize; i++)
+        origin2[i] = 0;
+    delete [] this->origin;
+    this->origin = origin2;
+    origin_arraysize = newSize;
+}
+
+void OspfLsaAck::setOrigin(size_t k, uint32_t origin)
+{
+    if (k >= origin_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)origin_arraysize, (unsigned long)k);
+    handleChange();
+    this->origin[k] = origin;
+}
+
+void OspfLsaAck::insertOrigin(size_t k, uint32_t origin)
+{
+    if (k > origin_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)origin_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = origin_arraysize + 1;
+    uint32_t *origin2 = new uint32_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        origin2[i] = this->origin[i];
+    origin2[k] = origin;
+    for (i = k + 1; i < newSize; i++)
+        origin2[i] = this->origin[i-1];
+    delete [] this->origin;
+    this->origin = origin2;
+    origin_arraysize = newSize;
+}
+
+void OspfLsaAck::appendOrigin(uint32_t origin)
+{
+    insertOrigin(origin_arraysize, origin);
+}
+
+void OspfLsaAck::eraseOrigin(size_t k)
+{
+    if (k >= origin_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)origin_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = origin_arraysize - 1;
+    uint32_t *origin2 = (newSize == 0) ? nullptr : new uint32_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        origin2[i] = this->origin[i];
+    for (i = k; i < newSize; i++)
+        origin2[i] = this->origin[i+1];
+    delete [] this->origin;
+    this->origin = origin2;
+    origin_arraysize = newSize;
+}
+
+size_t OspfLsaAck::getSeqNumArraySize() const
+{
+    return seqNum_arraysize;
+}
+
+uint32_t OspfLsaAck::getSeqNum(size_t k) const
+{
+    if (k >= seqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seqNum_arraysize, (unsigned long)k);
+    return this->seqNum[k];
+}
+
+void OspfLsaAck::setSeqNumArraySize(size_t newSize)
+{
+    handleChange();
+    uint32_t *seqNum2 = (newSize==0) ? nullptr : new uint32_t[newSize];
+    size_t minSize = seqNum_arraysize < newSize ? seqNum_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        seqNum2[i] = this->seqNum[i];
+    for (size_t i = minSize; i < newSize; i++)
+        seqNum2[i] = 0;
+    delete [] this->seqNum;
+    this->seqNum = seqNum2;
+    seqNum_arraysize = newSize;
+}
+
+void OspfLsaAck::setSeqNum(size_t k, uint32_t seqNum)
+{
+    if (k >= seqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seqNum_arraysize, (unsigned long)k);
+    handleChange();
+    this->seqNum[k] = seqNum;
+}
+
+void OspfLsaAck::insertSeqNum(size_t k, uint32_t seqNum)
+{
+    if (k > seqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seqNum_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = seqNum_arraysize + 1;
+    uint32_t *seqNum2 = new uint32_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        seqNum2[i] = this->seqNum[i];
+    seqNum2[k] = seqNum;
+    for (i = k + 1; i < newSize; i++)
+        seqNum2[i] = this->seqNum[i-1];
+    delete [] this->seqNum;
+    this->seqNum = seqNum2;
+    seqNum_arraysize = newSize;
+}
+
+void OspfLsaAck::appendSeqNum(uint32_t seqNum)
+{
+    insertSeqNum(seqNum_arraysize, seqNum);
+}
+
+void OspfLsaAck::eraseSeqNum(size_t k)
+{
+    if (k >= seqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seqNum_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = seqNum_arraysize - 1;
+    uint32_t *seqNum2 = (newSize == 0) ? nullptr : new uint32_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        seqNum2[i] = this->seqNum[i];
+    for (i = k; i < newSize; i++)
+        seqNum2[i] = this->seqNum[i+1];
+    delete [] this->seqNum;
+    this->seqNum = seqNum2;
+    seqNum_arraysize = newSize;
+}
+
+size_t OspfLsaAck::getHeldSeqNumArraySize() const
+{
+    return heldSeqNum_arraysize;
+}
+
+uint32_t OspfLsaAck::getHeldSeqNum(size_t k) const
+{
+    if (k >= heldSeqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)heldSeqNum_arraysize, (unsigned long)k);
+    return this->heldSeqNum[k];
+}
+
+void OspfLsaAck::setHeldSeqNumArraySize(size_t newSize)
+{
+    handleChange();
+    uint32_t *heldSeqNum2 = (newSize==0) ? nullptr : new uint32_t[newSize];
+    size_t minSize = heldSeqNum_arraysize < newSize ? heldSeqNum_arraysize : newSize;
+    for (size_t i = 0; i < minSize; i++)
+        heldSeqNum2[i] = this->heldSeqNum[i];
+    for (size_t i = minSize; i < newSize; i++)
+        heldSeqNum2[i] = 0;
+    delete [] this->heldSeqNum;
+    this->heldSeqNum = heldSeqNum2;
+    heldSeqNum_arraysize = newSize;
+}
+
+void OspfLsaAck::setHeldSeqNum(size_t k, uint32_t heldSeqNum)
+{
+    if (k >= heldSeqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)heldSeqNum_arraysize, (unsigned long)k);
+    handleChange();
+    this->heldSeqNum[k] = heldSeqNum;
+}
+
+void OspfLsaAck::insertHeldSeqNum(size_t k, uint32_t heldSeqNum)
+{
+    if (k > heldSeqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)heldSeqNum_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = heldSeqNum_arraysize + 1;
+    uint32_t *heldSeqNum2 = new uint32_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        heldSeqNum2[i] = this->heldSeqNum[i];
+    heldSeqNum2[k] = heldSeqNum;
+    for (i = k + 1; i < newSize; i++)
+        heldSeqNum2[i] = this->heldSeqNum[i-1];
+    delete [] this->heldSeqNum;
+    this->heldSeqNum = heldSeqNum2;
+    heldSeqNum_arraysize = newSize;
+}
+
+void OspfLsaAck::appendHeldSeqNum(uint32_t heldSeqNum)
+{
+    insertHeldSeqNum(heldSeqNum_arraysize, heldSeqNum);
+}
+
+void OspfLsaAck::eraseHeldSeqNum(size_t k)
+{
+    if (k >= heldSeqNum_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)heldSeqNum_arraysize, (unsigned long)k);
+    handleChange();
+    size_t newSize = heldSeqNum_arraysize - 1;
+    uint32_t *heldSeqNum2 = (newSize == 0) ? nullptr : new uint32_t[newSize];
+    size_t i;
+    for (i = 0; i < k; i++)
+        heldSeqNum2[i] = this->heldSeqNum[i];
+    for (i = k; i < newSize; i++)
+        heldSeqNum2[i] = this->heldSeqNum[i+1];
+    delete [] this->heldSeqNum;
+    this->heldSeqNum = heldSeqNum2;
+    heldSeqNum_arraysize = newSize;
+}
+
+class OspfLsaAckDescriptor : public omnetpp::cClassDescriptor
+{
+  private:
+    mutable const char **propertyNames;
+    enum FieldConstants {
+        FIELD_origin,
+        FIELD_seqNum,
+        FIELD_heldSeqNum,
+    };
+  public:
+    OspfLsaAckDescriptor();
+    virtual ~OspfLsaAckDescriptor();
+    virtual bool doesSupport(omnetpp::cObject *obj) const override;
+    virtual const char **getPropertyNames() const override;
+    virtual const char *getProperty(const char *propertyName) const override;
+    virtual int getFieldCount() const override;
+    virtual const char *getFieldName(int field) const override;
+    virtual int findField(const char *fieldName) const override;
+    virtual unsigned int getFieldTypeFlags(int field) const override;
+    virtual const char *getFieldTypeString(int field) const override;
+    virtual const char **getFieldPropertyNames(int field) const override;
+    virtual const char *getFieldProperty(int field, const char *propertyName) const override;
+    virtual int getFieldArraySize(omnetpp::any_ptr object, int field) const override;
+    virtual void setFieldArraySize(omnetpp::any_ptr object, int field, int size) const override;
+
+    virtual const char *getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const override;
+    virtual std::string getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const override;
+    virtual omnetpp::cValue getFieldValue(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const override;
+
+    virtual const char *getFieldStructName(int field) const override;
+    virtual omnetpp::any_ptr getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const override;
+    virtual void setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const override;
+};
+
+Register_ClassDescriptor(OspfLsaAckDescriptor)
+
+OspfLsaAckDescriptor::OspfLsaAckDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(OspfLsaAck)), "inet::FieldsChunk")
+{
+    propertyNames = nullptr;
+}
+
+OspfLsaAckDescriptor::~OspfLsaAckDescriptor()
+{
+    delete[] propertyNames;
+}
+
+bool OspfLsaAckDescriptor::doesSupport(omnetpp::cObject *obj) const
+{
+    return dynamic_cast<OspfLsaAck *>(obj)!=nullptr;
+}
+
+const char **OspfLsaAckDescriptor::getPropertyNames() const
+{
+    if (!propertyNames) {
+        static const char *names[] = {  nullptr };
+        omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+        const char **baseNames = base ? base->getPropertyNames() : nullptr;
+        propertyNames = mergeLists(baseNames, names);
+    }
+    return propertyNames;
+}
+
+const char *OspfLsaAckDescriptor::getProperty(const char *propertyName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    return base ? base->getProperty(propertyName) : nullptr;
+}
+
+int OspfLsaAckDescriptor::getFieldCount() const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    return base ? 3+base->getFieldCount() : 3;
+}
+
+unsigned int OspfLsaAckDescriptor::getFieldTypeFlags(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldTypeFlags(field);
+        field -= base->getFieldCount();
+    }
+    static unsigned int fieldTypeFlags[] = {
+        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_origin
+        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_seqNum
+        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_heldSeqNum
+    };
+    return (field >= 0 && field < 3) ? fieldTypeFlags[field] : 0;
+}
+
+const char *OspfLsaAckDescriptor::getFieldName(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldName(field);
+        field -= base->getFieldCount();
+    }
+    static const char *fieldNames[] = {
+        "origin",
+        "seqNum",
+        "heldSeqNum",
+    };
+    return (field >= 0 && field < 3) ? fieldNames[field] : nullptr;
+}
+
+int OspfLsaAckDescriptor::findField(const char *fieldName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    int baseIndex = base ? base->getFieldCount() : 0;
+    if (strcmp(fieldName, "origin") == 0) return baseIndex + 0;
+    if (strcmp(fieldName, "seqNum") == 0) return baseIndex + 1;
+    if (strcmp(fieldName, "heldSeqNum") == 0) return baseIndex + 2;
+    return base ? base->findField(fieldName) : -1;
+}
+
+const char *OspfLsaAckDescriptor::getFieldTypeString(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldTypeString(field);
+        field -= base->getFieldCount();
+    }
+    static const char *fieldTypeStrings[] = {
+        "uint32",    // FIELD_origin
+        "uint32",    // FIELD_seqNum
+        "uint32",    // FIELD_heldSeqNum
+    };
+    return (field >= 0 && field < 3) ? fieldTypeStrings[field] : nullptr;
+}
+
+const char **OspfLsaAckDescriptor::getFieldPropertyNames(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldPropertyNames(field);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+const char *OspfLsaAckDescriptor::getFieldProperty(int field, const char *propertyName) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldProperty(field, propertyName);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+int OspfLsaAckDescriptor::getFieldArraySize(omnetpp::any_ptr object, int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldArraySize(object, field);
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        case FIELD_origin: return pp->getOriginArraySize();
+        case FIELD_seqNum: return pp->getSeqNumArraySize();
+        case FIELD_heldSeqNum: return pp->getHeldSeqNumArraySize();
+        default: return 0;
+    }
+}
+
+void OspfLsaAckDescriptor::setFieldArraySize(omnetpp::any_ptr object, int field, int size) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldArraySize(object, field, size);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        case FIELD_origin: pp->setOriginArraySize(size); break;
+        case FIELD_seqNum: pp->setSeqNumArraySize(size); break;
+        case FIELD_heldSeqNum: pp->setHeldSeqNumArraySize(size); break;
+        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'OspfLsaAck'", field);
+    }
+}
+
+const char *OspfLsaAckDescriptor::getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldDynamicTypeString(object,field,i);
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        default: return nullptr;
+    }
+}
+
+std::string OspfLsaAckDescriptor::getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldValueAsString(object,field,i);
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        case FIELD_origin: return ulong2string(pp->getOrigin(i));
+        case FIELD_seqNum: return ulong2string(pp->getSeqNum(i));
+        case FIELD_heldSeqNum: return ulong2string(pp->getHeldSeqNum(i));
+        default: return "";
+    }
+}
+
+void OspfLsaAckDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldValueAsString(object, field, i, value);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        case FIELD_origin: pp->setOrigin(i,string2ulong(value)); break;
+        case FIELD_seqNum: pp->setSeqNum(i,string2ulong(value)); break;
+        case FIELD_heldSeqNum: pp->setHeldSeqNum(i,string2ulong(value)); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'OspfLsaAck'", field);
+    }
+}
+
+omnetpp::cValue OspfLsaAckDescriptor::getFieldValue(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldValue(object,field,i);
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        case FIELD_origin: return (omnetpp::intval_t)(pp->getOrigin(i));
+        case FIELD_seqNum: return (omnetpp::intval_t)(pp->getSeqNum(i));
+        case FIELD_heldSeqNum: return (omnetpp::intval_t)(pp->getHeldSeqNum(i));
+        default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'OspfLsaAck' as cValue -- field index out of range?", field);
+    }
+}
+
+void OspfLsaAckDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldValue(object, field, i, value);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        case FIELD_origin: pp->setOrigin(i,omnetpp::checked_int_cast<uint32_t>(value.intValue())); break;
+        case FIELD_seqNum: pp->setSeqNum(i,omnetpp::checked_int_cast<uint32_t>(value.intValue())); break;
+        case FIELD_heldSeqNum: pp->setHeldSeqNum(i,omnetpp::checked_int_cast<uint32_t>(value.intValue())); break;
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'OspfLsaAck'", field);
+    }
+}
+
+const char *OspfLsaAckDescriptor::getFieldStructName(int field) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldStructName(field);
+        field -= base->getFieldCount();
+    }
+    switch (field) {
+        default: return nullptr;
+    };
+}
+
+omnetpp::any_ptr OspfLsaAckDescriptor::getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount())
+            return base->getFieldStructValuePointer(object, field, i);
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        default: return omnetpp::any_ptr(nullptr);
+    }
+}
+
+void OspfLsaAckDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const
+{
+    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
+    if (base) {
+        if (field < base->getFieldCount()){
+            base->setFieldStructValuePointer(object, field, i, ptr);
+            return;
+        }
+        field -= base->getFieldCount();
+    }
+    OspfLsaAck *pp = omnetpp::fromAnyPtr<OspfLsaAck>(object); (void)pp;
+    switch (field) {
+        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'OspfLsaAck'", field);
+    }
+}
+
 namespace omnetpp {
 
 }  // namespace omnetpp
@@ -17,6 +17,7 @@
 #endif
 
 class OspfLsa;
+class OspfLsaAck;
 #include "inet/common/INETDefs_m.h" // import inet.common.INETDefs
 
 #include "inet/common/packet/chunk/Chunk_m.h" // import inet.common.packet.chunk.Chunk
@@ -32,8 +33,10 @@ class OspfLsa;
  *     simtime_t installTime;
  *     uint32 neighbor[]; // the int format of the neighbor IP addresses
  *     double cost[];                // corresponding costs
+ *     bool isDelta;   // only the changed adjacencies are carried, a negative cost marks a removed adjacency
+ *     uint32 baseSeqNum;  // for delta LSAs, the seqNum the changes apply on top of
  * 
- *     chunkLength = inet::B(28); // origin + nodeId + seqNum + installTime + neighbor + cost
+ *     chunkLength = inet::B(25); // origin + nodeId + seqNum + installTime + isDelta + baseSeqNum, 12 bytes (neighbor + cost) are added per adjacency
  * }
  * </pre>
  */
@@ -48,6 +51,8 @@ class OspfLsa : public ::inet::FieldsChunk
     size_t neighbor_arraysize = 0;
     double *cost = nullptr;
     size_t cost_arraysize = 0;
+    bool isDelta_ = false;
+    uint32_t baseSeqNum = 0;
 
   private:
     void copy(const OspfLsa& other);
@@ -93,15 +98,91 @@ class OspfLsa : public ::inet::FieldsChunk
     [[deprecated]] void insertCost(double cost) {appendCost(cost);}
     virtual void appendCost(double cost);
     virtual void eraseCost(size_t k);
+
+    virtual bool isDelta() const;
+    virtual void setIsDelta(bool isDelta);
+
+    virtual uint32_t getBaseSeqNum() const;
+    virtual void setBaseSeqNum(uint32_t baseSeqNum);
 };
 
 inline void doParsimPacking(omnetpp::cCommBuffer *b, const OspfLsa& obj) {obj.parsimPack(b);}
 inline void doParsimUnpacking(omnetpp::cCommBuffer *b, OspfLsa& obj) {obj.parsimUnpack(b);}
 
+/**
+ * Class generated from <tt>mecrt/packets/routing/OspfLsa.msg:37</tt> by opp_msgtool.
+ * <pre>
+ * class OspfLsaAck extends inet::FieldsChunk
+ * {
+ *     uint32 origin[];        // the origins of the acknowledged LSAs
+ *     uint32 seqNum[];        // the seqNum of each received LSA
+ *     uint32 heldSeqNum[];    // the seqNum the receiver holds for the origin after processing
+ * 
+ *     chunkLength = inet::B(0); // 12 bytes are added per acknowledged LSA
+ * }
+ * </pre>
+ */
+class OspfLsaAck : public ::inet::FieldsChunk
+{
+  protected:
+    uint32_t *origin = nullptr;
+    size_t origin_arraysize = 0;
+    uint32_t *seqNum = nullptr;
+    size_t seqNum_arraysize = 0;
+    uint32_t *heldSeqNum = nullptr;
+    size_t heldSeqNum_arraysize = 0;
+
+  private:
+    void copy(const OspfLsaAck& other);
+
+  protected:
+    bool operator==(const OspfLsaAck&) = delete;
+
+  public:
+    OspfLsaAck();
+    OspfLsaAck(const OspfLsaAck& other);
+    virtual ~OspfLsaAck();
+    OspfLsaAck& operator=(const OspfLsaAck& other);
+    virtual OspfLsaAck *dup() const override {return new OspfLsaAck(*this);}
+    virtual void parsimPack(omnetpp::cCommBuffer *b) const override;
+    virtual void parsimUnpack(omnetpp::cCommBuffer *b) override;
+
+    virtual void setOriginArraySize(size_t size);
+    virtual size_t getOriginArraySize() const;
+    virtual uint32_t getOrigin(size_t k) const;
+    virtual void setOrigin(size_t k, uint32_t origin);
+    virtual void insertOrigin(size_t k, uint32_t origin);
+    [[deprecated]] void insertOrigin(uint32_t origin) {appendOrigin(origin);}
+    virtual void appendOrigin(uint32_t origin);
+    virtual void eraseOrigin(size_t k);
+
+    virtual void setSeqNumArraySize(size_t size);
+    virtual size_t getSeqNumArraySize() const;
+    virtual uint32_t getSeqNum(size_t k) const;
+    virtual void setSeqNum(size_t k, uint32_t seqNum);
+    virtual void insertSeqNum(size_t k, uint32_t seqNum);
+    [[deprecated]] void insertSeqNum(uint32_t seqNum) {appendSeqNum(seqNum);}
+    virtual void appendSeqNum(uint32_t seqNum);
+    virtual void eraseSeqNum(size_t k);
+
+    virtual void setHeldSeqNumArraySize(size_t size);
+    virtual size_t getHeldSeqNumArraySize() const;
+    virtual uint32_t getHeldSeqNum(size_t k) const;
+    virtual void setHeldSeqNum(size_t k, uint32_t heldSeqNum);
+    virtual void insertHeldSeqNum(size_t k, uint32_t heldSeqNum);
+    [[deprecated]] void insertHeldSeqNum(uint32_t heldSeqNum) {appendHeldSeqNum(heldSeqNum);}
+    virtual void appendHeldSeqNum(uint32_t heldSeqNum);
+    virtual void eraseHeldSeqNum(size_t k);
+};
+
+inline void doParsimPacking(omnetpp::cCommBuffer *b, const OspfLsaAck& obj) {obj.parsimPack(b);}
+inline void doParsimUnpacking(omnetpp::cCommBuffer *b, OspfLsaAck& obj) {obj.parsimUnpack(b);}
+
 
 namespace omnetpp {
 
 template<> inline OspfLsa *fromAnyPtr(any_ptr ptr) { return check_and_cast<OspfLsa*>(ptr.get<cObject>()); }
+template<> inline OspfLsaAck *fromAnyPtr(any_ptr ptr) { return check_and_cast<OspfLsaAck*>(ptr.get<cObject>()); }
 
 }  // namespace omnetpp
 
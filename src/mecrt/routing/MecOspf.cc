@@ -32,6 +32,7 @@
 #include "mecrt/common/MecCommon.h"
 
 #include "inet/common/IProtocolRegistrationListener.h"
+#include "inet/common/ModuleAccess.h"
 #include "inet/networklayer/common/NetworkInterface.h"
 
 #include <inet/networklayer/ipv4/Ipv4Header_m.h>
@@ -44,15 +45,19 @@
 #include "inet/common/packet/Packet.h"
 #include "inet/common/packet/chunk/ByteCountChunk.h"
 #include <queue>
+#include <algorithm>
 
 Define_Module(MecOspf);
 
+map<cModule*, MecOspf*> MecOspf::bootstrapRouters_;
 
 MecOspf::MecOspf()
 {
     helloTimer_ = nullptr;
     lsaTimer_ = nullptr;
     routeComputationTimer_ = nullptr;
+    lsaFlushTimer_ = nullptr;
+    lsaRetransmitTimer_ = nullptr;
 
     ift_ = nullptr;
     rt_ = nullptr;
@@ -68,6 +73,13 @@ MecOspf::~MecOspf()
     if (enableInitDebug_)
         std::cout << "MecOspf::~MecOspf - destroying OSPF protocol\n";
 
+    for (auto it = bootstrapRouters_.begin(); it != bootstrapRouters_.end(); ++it) {
+        if (it->second == this) {
+            bootstrapRouters_.erase(it);
+            break;
+        }
+    }
+
     if (helloTimer_) {
         cancelAndDelete(helloTimer_);
         helloTimer_ = nullptr;
@@ -83,6 +95,16 @@ MecOspf::~MecOspf()
         routeComputationTimer_ = nullptr;
     }
 
+    if (lsaFlushTimer_) {
+        cancelAndDelete(lsaFlushTimer_);
+        lsaFlushTimer_ = nullptr;
+    }
+
+    if (lsaRetransmitTimer_) {
+        cancelAndDelete(lsaRetransmitTimer_);
+        lsaRetransmitTimer_ = nullptr;
+    }
+
     if (enableInitDebug_)
         std::cout << "MecOspf::~MecOspf - cleaning up OSPF protocol done!\n";
 }
@@ -109,11 +131,21 @@ void MecOspf::initialize(int stage)
         lsaTimer_->setSchedulingPriority(1); // after other messages
         routeComputationTimer_ = new cMessage("routeComputationTimer");
         routeComputationTimer_->setSchedulingPriority(1); // after other messages
+        lsaFlushTimer_ = new cMessage("lsaFlushTimer");
+        lsaFlushTimer_->setSchedulingPriority(1); // after other messages
+        lsaRetransmitTimer_ = new cMessage("lsaRetransmitTimer");
+        lsaRetransmitTimer_->setSchedulingPriority(1); // after other messages
 
         lsaWaitInterval_ = par("lsaWaitInterval").doubleValue();
         helloInterval_ = par("helloInterval").doubleValue();
         neighborTimeout_ = 2 * helloInterval_; // set dead interval as 2*helloInterval
         routeComputationDelay_ = par("routeComputationDelay").doubleValue();
+        bootstrapTopology_ = par("bootstrapTopology").boolValue();
+        enableLfa_ = par("enableLfa").boolValue();
+        deltaLsa_ = par("deltaLsa").boolValue();
+        lsaCoalesceWindow_ = par("lsaCoalesceWindow").doubleValue();
+        lsaRetransmitInterval_ = par("lsaRetransmitInterval").doubleValue();
+        bootstrapRouters_.clear();  // drop the entries of a previous run, all routers register again in INITSTAGE_NETWORK_LAYER
 
         simtime_t startupTime = par("startupTime");
         scheduleAfter(startupTime, helloTimer_);
@@ -123,6 +155,11 @@ void MecOspf::initialize(int stage)
         WATCH(neighborTimeout_);
         WATCH(routeComputationDelay_);
         WATCH(globalSchedulerReady_);
+        WATCH(bootstrapTopology_);
+        WATCH(enableLfa_);
+        WATCH(deltaLsa_);
+        WATCH(lsaCoalesceWindow_);
+        WATCH(lsaRetransmitInterval_);
 
         if (enableInitDebug_)
             cout << "MecOspf:initialize - stage: INITSTAGE_LOCAL - done\n";
@@ -171,6 +208,10 @@ void MecOspf::initialize(int stage)
             throw cRuntimeError("MecOspf:initialize - cannot find routingTableModule param\n");
         }
 
+        // register for the bootstrap, inactive nodes are left out and will be discovered by Hello once recovered
+        if (bootstrapTopology_ && (!nodeInfo_ || nodeInfo_->isNodeActive()))
+            bootstrapRouters_[findContainingNode(this)] = this;
+
         // nothing to do here, just for logging purpose
         if (enableInitDebug_)
             cout << "MecOspf:initialize - stage: INITSTAGE_NETWORK_LAYER - routerId=" << routerId_ << "\n";
@@ -221,6 +262,9 @@ void MecOspf::initialize(int stage)
         ipv4ToMacNodeId_[routerIdKey_] = selfLsa_->getNodeId();
         topology_[routerIdKey_] = map<uint32_t, double>();
 
+        if (bootstrapTopology_ && bootstrapRouters_.count(findContainingNode(this)))
+            bootstrapNeighbors();
+
         WATCH(routerId_);
         WATCH(routerIdKey_);
         WATCH(neighborChanged_);
@@ -251,6 +295,9 @@ void MecOspf::initialize(int stage)
         WATCH(localPort_);
         WATCH(socketId_);
 
+        if (bootstrapTopology_ && bootstrapRouters_.count(findContainingNode(this)))
+            bootstrapTopology();
+
         if (enableInitDebug_)
             cout << "MecOspf::initialize - stage: INITSTAGE_APPLICATION_LAYER - done\n";
     }
@@ -296,6 +343,14 @@ void MecOspf::handleMessage(cMessage *msg)
             packet = nullptr;
             return;
         }
+        else if (pname && strcmp(pname, "OspfLsaAck") == 0) {
+            EV_INFO << "MecOspf:handleMessage - OspfLsaAck received\n";
+            handleReceivedLsaAck(packet);
+
+            delete packet;
+            packet = nullptr;
+            return;
+        }
         else
         {
             // Otherwise treat as data packet to forward
@@ -359,6 +414,20 @@ void MecOspf::handleSelfTimer(cMessage *msg)
         // recompute routes to all nodes in the topology
         recomputeIndirectRouting();
     }
+    else if (msg == lsaFlushTimer_)
+    {
+        EV_INFO << "MecOspf::handleSelfTimer - LSA flush timer fired at " << simTime() << "\n";
+
+        // send the LSAs coalesced in this window
+        flushPendingLsas();
+    }
+    else if (msg == lsaRetransmitTimer_)
+    {
+        EV_INFO << "MecOspf::handleSelfTimer - LSA retransmit timer fired at " << simTime() << "\n";
+
+        // resend the LSAs whose acknowledgement is overdue
+        retransmitUnackedLsas();
+    }
     else
     {
         EV_WARN << "MecOspf::handleSelfTimer - unknown self-message: " << msg->getName() << "\n";
@@ -400,44 +469,60 @@ void MecOspf::handleSelfLsaTimer()
 
     EV << "MecOspf:handleSelfLsaTimer - neighbor change detected, updating LSA and sending to network\n";
 
-    seqNum_++;
-
     // update our own LSA packet cache
-    selfLsa_->setSeqNum(seqNum_);
-    simtime_t installTime = simTime();
-    selfLsa_->setInstallTime(installTime);
-    // reset and add neighbor list to LSA chunk
-    int neighborCount = neighbors_.size();
-    selfLsa_->setNeighborArraySize(neighborCount);
-    selfLsa_->setCostArraySize(neighborCount);
-    int idx = 0;
-    for (const auto& n : neighbors_) {
-        selfLsa_->setNeighbor(idx, n.second.destIp.getInt());
-        selfLsa_->setCost(idx, n.second.cost);
-        idx++;
+    inet::Ptr<OspfLsa> delta = nullptr;
+    if (deltaLsa_) {
+        OspfLsa oldLsa = *selfLsa_;
+        refreshSelfLsa();
+        delta = makeDeltaLsa(oldLsa, *selfLsa_);
     }
+    else
+        refreshSelfLsa();
 
     // send LSA to neighbors
-    updateLsaToNetwork();
+    updateLsaToNetwork(delta);
 
     // reset neighbor change flag and clear new neighbor list
     neighborChanged_ = false;
     newNeighbors_.clear();
 
+    scheduleRouteComputation(selfLsa_->getInstallTime());
+}
+
+
+/***
+ * === scheduleRouteComputation ===
+ * Without delta LSAs, the computation is postponed until routeComputationDelay_ after the latest LSA install time.
+ * With delta LSAs, it runs once at the end of the coalescing window in which the first change arrived.
+ */
+void MecOspf::scheduleRouteComputation(simtime_t lsaInstallTime)
+{
+    if (deltaLsa_)
+    {
+        if (!routeComputationTimer_->isScheduled())
+        {
+            scheduleAt(simTime() + lsaCoalesceWindow_, routeComputationTimer_);
+            EV << "MecOspf:scheduleRouteComputation - scheduled route recomputation at " << (simTime() + lsaCoalesceWindow_) << "\n";
+        }
+        return;
+    }
+
     if (!routeComputationTimer_->isScheduled())
     {
-        scheduleAt(installTime + routeComputationDelay_, routeComputationTimer_);
-        largestLsaTime_ = installTime;
+        scheduleAt(lsaInstallTime + routeComputationDelay_, routeComputationTimer_);
+        largestLsaTime_ = lsaInstallTime;
 
-        EV << "MecOspf:handleSelfLsaTimer - scheduled route recomputation at " << (installTime + routeComputationDelay_) << "\n";
+        EV << "MecOspf:scheduleRouteComputation - scheduled route recomputation at " << (lsaInstallTime + routeComputationDelay_) << "\n";
     }
-    else if (routeComputationTimer_->isScheduled() && largestLsaTime_ < installTime)
+    else if (largestLsaTime_ < lsaInstallTime)
     {
-        largestLsaTime_ = installTime;
+        // if some LSA is generated at a later time, we can cancel and reschedule
+        // the routeComputationTimer_ to a later time to avoid multiple recomputations
+        largestLsaTime_ = lsaInstallTime;
         cancelEvent(routeComputationTimer_);
-        scheduleAt(installTime + routeComputationDelay_, routeComputationTimer_);
+        scheduleAt(largestLsaTime_ + routeComputationDelay_, routeComputationTimer_);
 
-        EV << "MecOspf:handleSelfLsaTimer - rescheduled route recomputation at " << (installTime + routeComputationDelay_) << "\n";
+        EV << "MecOspf:scheduleRouteComputation - rescheduled route recomputation at " << (largestLsaTime_ + routeComputationDelay_) << "\n";
     }
 }
 
@@ -577,26 +662,17 @@ void MecOspf::processHello(Packet *packet)
         EV_INFO << "MecOspf:processHello - discovered neighbor " << neighborIp << " (discovered neighbors in total:" << neighbors_.size() << ")\n";
 
         // add route to neighbor
-        if (rt_) {
-            Ipv4Route *route = new Ipv4Route();
-            route->setDestination(neighborIp);
-            route->setNetmask(Ipv4Address::ALLONES_ADDRESS); // host route
-            route->setGateway(gateway);
-            route->setInterface(arrivalIf);
-            route->setSourceType(Ipv4Route::OSPF);
-            route->setMetric(1);
-            rt_->addRoute(route);
-            neighborRoutes_[key] = route;
-            EV_INFO << "MecOspf:processHello - added direct route to neighbor " << neighborIp << "\n";
-        }
+        addNeighborRoute(key, n);
 
         neighborChanged_ = true; // mark neighbor change happened
         newNeighbors_.push_back(key);
+        neighborSeqNum_.erase(key); // a (re)discovered neighbor may have lost LSAs, it gets full copies
+        unackedLsas_.erase(key);
         resetGlobalScheduler(); // reset global scheduler info
-        clearIndirectRoutes(); // clear cached indirect routes
 
         // Update adjacency map (bidirectional link with cost n.cost)
         topology_[routerIdKey_][key] = n.cost;
+        spfDirtyRows_.insert(routerIdKey_);
         EV_DETAIL << "MecOspf:processHello - updated LSA for " << routerId_ << ": seqNum=" << lsaPacketCache_[routerIdKey_]->getSeqNum()
                   << " neighbors=" << topology_[routerIdKey_].size() << "\n";
     }
@@ -608,13 +684,153 @@ void MecOspf::processHello(Packet *packet)
 }
 
 
+void MecOspf::addNeighborRoute(uint32_t key, const Neighbor& n)
+{
+    if (!rt_)
+        return;
+
+    Ipv4Route *route = new Ipv4Route();
+    route->setDestination(n.destIp);
+    route->setNetmask(Ipv4Address::ALLONES_ADDRESS); // host route
+    route->setGateway(n.gateway);
+    route->setInterface(n.outInterface);
+    route->setSourceType(Ipv4Route::OSPF);
+    route->setMetric(1);
+    rt_->addRoute(route);
+    neighborRoutes_[key] = route;
+    EV_INFO << "MecOspf:addNeighborRoute - added direct route to neighbor " << n.destIp << "\n";
+}
+
+
+void MecOspf::refreshSelfLsa()
+{
+    seqNum_++;
+
+    selfLsa_->setSeqNum(seqNum_);
+    selfLsa_->setInstallTime(simTime());
+    // reset and add neighbor list to LSA chunk
+    int neighborCount = neighbors_.size();
+    selfLsa_->setNeighborArraySize(neighborCount);
+    selfLsa_->setCostArraySize(neighborCount);
+    int idx = 0;
+    for (const auto& n : neighbors_) {
+        selfLsa_->setNeighbor(idx, n.second.destIp.getInt());
+        selfLsa_->setCost(idx, n.second.cost);
+        idx++;
+    }
+    setLsaLength(*selfLsa_);
+}
+
+
+/***
+ * === bootstrapNeighbors ===
+ * Bootstrap mode, called in INITSTAGE_ROUTING_PROTOCOLS.
+ * Follow the link behind each wired interface (the connections of the map, see connections.txt) to the
+ * interface of the peer node. If the peer runs MecOspf as well, it becomes a neighbor as if its Hello
+ * feedback had been received, with the address of the peer interface as gateway.
+ */
+void MecOspf::bootstrapNeighbors()
+{
+    for (int i = 0; i < ift_->getNumInterfaces(); ++i) {
+        NetworkInterface *ie = ift_->getInterface(i);
+        if (!ie || ie->isLoopback() || !ie->isUp() || ie->isWireless()) // skip loopback/down/wireless interfaces
+            continue;
+        if (ie->getIpv4Address().isUnspecified() || ie->getNodeOutputGateId() < 0)
+            continue;
+
+        NetworkInterface *peerIf = findPeerInterface(ie);
+        if (!peerIf || !peerIf->isUp() || peerIf->getIpv4Address().isUnspecified())
+            continue;
+
+        auto it = bootstrapRouters_.find(findContainingNode(peerIf));
+        if (it == bootstrapRouters_.end() || it->second == this)   // the peer does not run OSPF
+            continue;
+
+        Ipv4Address neighborIp = it->second->routerId_;
+        uint32_t key = ipKey(neighborIp);
+        if (neighbors_.find(key) != neighbors_.end())   // parallel link, keep the first one
+            continue;
+
+        Neighbor n = Neighbor(neighborIp, peerIf->getIpv4Address(), ie, simTime(), 1.0);
+        neighbors_.emplace(key, n);
+        addNeighborRoute(key, n);
+        topology_[routerIdKey_][key] = n.cost;
+    }
+
+    // publish our neighbor list, the other routers read it in INITSTAGE_APPLICATION_LAYER
+    refreshSelfLsa();
+
+    EV_INFO << "MecOspf:bootstrapNeighbors - " << neighbors_.size() << " neighbors installed from the network topology\n";
+}
+
+
+// Helper: the interface at the other end of the link behind a local wired interface
+NetworkInterface *MecOspf::findPeerInterface(NetworkInterface *ie)
+{
+    if (!ie || ie->getNodeOutputGateId() < 0)
+        return nullptr;
+
+    cGate *endGate = findContainingNode(this)->gate(ie->getNodeOutputGateId())->getPathEndGate();
+    return findContainingNicModule(endGate->getOwnerModule());
+}
+
+
+// Helper: the MecOspf instance running in a node, if any
+MecOspf *MecOspf::findOspfInNode(cModule *node)
+{
+    if (!node)
+        return nullptr;
+
+    for (cModule::SubmoduleIterator it(node); !it.end(); ++it) {
+        MecOspf *ospf = dynamic_cast<MecOspf *>(*it);
+        if (ospf)
+            return ospf;
+    }
+    return nullptr;
+}
+
+
+/***
+ * === bootstrapTopology ===
+ * Bootstrap mode, called in INITSTAGE_APPLICATION_LAYER.
+ * Every router has filled its own LSA by now, so the LSA database is complete without flooding.
+ * The indirect routes and the scheduler election run at t = 0 through the regular timers, once
+ * all modules (scheduler, MAC, ...) that react to the election result are initialized.
+ */
+void MecOspf::bootstrapTopology()
+{
+    for (const auto& kv : bootstrapRouters_) {
+        if (kv.second == this)
+            continue;
+
+        inet::Ptr<const OspfLsa> lsa = makeShared<OspfLsa>(*kv.second->selfLsa_);
+        uint32_t originKey = lsa->getOrigin();
+        lsaPacketCache_[originKey] = makeShared<OspfLsa>(*lsa);
+        ipv4ToMacNodeId_[originKey] = lsa->getNodeId();
+        updateTopologyFromLsa(lsa);
+    }
+
+    EV_INFO << "MecOspf:bootstrapTopology - loaded " << lsaPacketCache_.size() << " LSAs from the network topology\n";
+
+    // the lsaTimer_ initializes the local scheduler in the distributed scheme
+    if (enableDistScheme_ || distTestMode_)
+        scheduleAt(simTime(), lsaTimer_);
+    else
+        scheduleAt(simTime(), routeComputationTimer_);
+
+    // Hello keeps running only to detect failures; without route update there is nothing to detect
+    if (!routeUpdate_ && helloTimer_->isScheduled())
+        cancelEvent(helloTimer_);
+}
+
+
 /***
  * === sendLsa ===
  * Create and send a LSA Packet to all neighbors (multicast).
  * The LSA contains our router ID, sequence number, and list of neighbors.
  * Neighbors receiving the LSA can update their topology graph and recompute routes.
  */
-void MecOspf::updateLsaToNetwork()
+void MecOspf::updateLsaToNetwork(inet::Ptr<const OspfLsa> delta)
 {
     if (!ift_) {
         EV_WARN << "MecOspf::updateLsaToNetwork - no InterfaceTable available\n";
@@ -628,7 +844,10 @@ void MecOspf::updateLsaToNetwork()
         if (!n.outInterface || !n.outInterface->isUp() || n.outInterface->isWireless()) continue;
 
         EV_INFO << "MecOspf:sendLsaToNeighbor - sending LSA to neighbor " << n.destIp << "\n";
-        sendLsa(selfLsa_, kv.first);
+        if (deltaLsa_)
+            queueLsa(delta ? delta : inet::Ptr<const OspfLsa>(selfLsa_), kv.first);
+        else
+            sendLsa(selfLsa_, kv.first);
     }
 
     // send other LSAs that we know (in the lsaPacketCache_) to new neighbors 
@@ -651,7 +870,10 @@ void MecOspf::updateLsaToNetwork()
 
                 EV_INFO << "MecOspf:sendLsaToNeighbor - sending cached LSA originating from " << lsaEntry.second->getOrigin()
                         << " to new neighbor " << n.destIp << "\n";
-                sendLsa(lsaEntry.second, key);
+                if (deltaLsa_)
+                    queueLsa(lsaEntry.second, key);
+                else
+                    sendLsa(lsaEntry.second, key);
             }
         }
     }
@@ -663,72 +885,184 @@ void MecOspf::updateLsaToNetwork()
  * check if the LSA is new (higher seqNum) and update lsdb_.
  * If updated, recompute routing and forward LSA to neighbors (except the one it came from).
  * If not new, discard.
+ * With delta LSAs, a packet may carry several LSAs (full or delta) merged by the sender.
  */
 void MecOspf::handleReceivedLsa(Packet *packet)
 {
-    // Extract LSA from packet
-    auto lsa = packet->peekAtFront<OspfLsa>();
-    if (!lsa) {
-        EV_WARN << "MecOspf:handleReceivedLsa - not an OSPF LSA packet\n";
-        return;
-    }
+    // get the arrival interface (to avoid sending back)
+    auto ifaceInd = packet->findTag<InterfaceInd>();
+    int arrivalIfId = ifaceInd->getInterfaceId();
+
+    // the neighbor the packet came from, to record which LSAs it already has
+    uint32_t senderKey = findNeighborByInterface(arrivalIfId);
+
+    // delta LSA mode: every LSA of the packet is acknowledged with the seqNum we hold afterwards
+    auto ack = makeShared<OspfLsaAck>();
+    while (packet->getDataLength() > b(0)) {
+        // Extract LSA from packet
+        auto lsa = packet->popAtFront<OspfLsa>();
+        if (!lsa) {
+            EV_WARN << "MecOspf:handleReceivedLsa - not an OSPF LSA packet\n";
+            return;
+        }
 
-    // Check if LSA is new (higher seqNum)
-    bool needUpdate = false;
-    // if the origin router is not in cache, add it
-    uint32_t originKey = lsa->getOrigin();
-    if (lsaPacketCache_.find(originKey) == lsaPacketCache_.end())   // first time seeing this origin
-    {
-        needUpdate = true;
-        ipv4ToMacNodeId_[originKey] = lsa->getNodeId();
-    }    
+        uint32_t originKey = lsa->getOrigin();
+        uint32_t lsaSeqNum = lsa->getSeqNum();
+        if (deltaLsa_ && senderKey != 0) {
+            uint32_t &known = neighborSeqNum_[senderKey][originKey];
+            known = max(known, lsaSeqNum);
+
+            auto cached = lsaPacketCache_.find(originKey);
+            ack->appendOrigin(originKey);
+            ack->appendSeqNum(lsaSeqNum);
+            ack->appendHeldSeqNum(cached == lsaPacketCache_.end() ? 0 : cached->second->getSeqNum());
+        }
+
+        auto cached = lsaPacketCache_.find(originKey);
+        if (cached != lsaPacketCache_.end() && lsaSeqNum <= cached->second->getSeqNum()) {
+            // duplicate suppression by (origin, seqNum)
+            EV_INFO << "MecOspf:handleReceivedLsa - received old LSA from " << Ipv4Address(originKey) << ", ignore it!\n";
+            continue;
+        }
 
-    int lsaSeqNum = lsa->getSeqNum();
-    if (!needUpdate && (lsaSeqNum > lsaPacketCache_[originKey]->getSeqNum()))   // not first time but higher seqNum
-        needUpdate = true;
+        // Check if LSA is new (higher seqNum)
+        inet::Ptr<const OspfLsa> fullLsa = lsa;
+        if (lsa->isDelta()) {
+            if (cached == lsaPacketCache_.end() || cached->second->getSeqNum() < lsa->getBaseSeqNum()) {
+                EV_WARN << "MecOspf:handleReceivedLsa - delta LSA from " << Ipv4Address(originKey) << " (seqNum=" << lsaSeqNum
+                        << ") does not apply to our copy, ignore it!\n";
+                continue;
+            }
+            auto updated = makeShared<OspfLsa>(*cached->second);
+            applyDeltaLsa(*updated, *lsa);
+            fullLsa = updated;
+        }
+        else if (cached == lsaPacketCache_.end()) {  // first time seeing this origin
+            ipv4ToMacNodeId_[originKey] = lsa->getNodeId();
+        }
 
-    if (needUpdate) {
         // Update LSA database
-        lsaPacketCache_[originKey] = makeShared<OspfLsa>(*lsa);
-        EV_INFO << "MecOspf:handleReceivedLsa - received updated LSA from " << Ipv4Address(originKey) << "\n";
+        lsaPacketCache_[originKey] = makeShared<OspfLsa>(*fullLsa);
+        if (ack->getHeldSeqNumArraySize() > 0 && ack->getOrigin(ack->getOriginArraySize() - 1) == originKey)
+            ack->setHeldSeqNum(ack->getHeldSeqNumArraySize() - 1, lsaSeqNum);
+        EV_INFO << "MecOspf:handleReceivedLsa - received updated LSA from " << Ipv4Address(originKey)
+                << (lsa->isDelta() ? " (delta)" : "") << "\n";
 
         resetGlobalScheduler(); // reset global scheduler info
-        updateTopologyFromLsa(lsa); // Update topology graph
-        clearIndirectRoutes(); // clear cached indirect routes
-
-        // get the arrival interface (to avoid sending back)
-        auto ifaceInd = packet->findTag<InterfaceInd>();
-        int arrivalIfId = ifaceInd->getInterfaceId();
+        updateTopologyFromLsa(fullLsa); // Update topology graph, the routes are updated in the next route computation
 
         // Forward LSA to neighbors (except the one it came from)
         for (const auto& n : neighbors_) {
             if (n.second.outInterface->getInterfaceId() != arrivalIfId) {
-                sendLsa(lsa, n.first);
+                if (deltaLsa_)
+                    queueLsa(lsa, n.first);
+                else
+                    sendLsa(lsa, n.first);
             }
         }
 
         // schedule route recomputation after a short delay to ensure the propagation is complete
-        simtime_t lsaInstallTime = lsa->getInstallTime();
-        if (!routeComputationTimer_->isScheduled())
-        {
-            scheduleAt(lsaInstallTime + routeComputationDelay_, routeComputationTimer_);
-            largestLsaTime_ = lsaInstallTime;
+        scheduleRouteComputation(lsa->getInstallTime());
+    }
+
+    if (ack->getOriginArraySize() > 0) {
+        ack->setChunkLength(B(12 * (int)ack->getOriginArraySize()));
+        Packet *ackPkt = new Packet("OspfLsaAck");
+        ackPkt->insertAtBack(ack);
+        ackPkt->addTagIfAbsent<InterfaceReq>()->setInterfaceId(arrivalIfId);
+
+        EV_INFO << "MecOspf:handleReceivedLsa - acknowledging " << ack->getOriginArraySize() << " LSAs to neighbor "
+                << Ipv4Address(senderKey) << "\n";
+        socket_.sendTo(ackPkt, Ipv4Address::ALL_OSPF_ROUTERS_MCAST, MEC_OSPF_PORT);
+    }
+}
+
+
+/***
+ * === handleReceivedLsaAck ===
+ * Delta LSA mode: the neighbor confirms the seqNum it holds for each origin. A held seqNum below the
+ * acknowledged one means a delta did not apply to its copy, so it gets the full LSA in the next flush.
+ */
+void MecOspf::handleReceivedLsaAck(Packet *packet)
+{
+    uint32_t neighborKey = findNeighborByInterface(packet->findTag<InterfaceInd>()->getInterfaceId());
+    if (neighborKey == 0) {
+        EV_WARN << "MecOspf:handleReceivedLsaAck - acknowledgement from an unknown neighbor, ignore it!\n";
+        return;
+    }
+
+    auto ack = packet->popAtFront<OspfLsaAck>();
+    auto &known = neighborSeqNum_[neighborKey];
+    auto &unacked = unackedLsas_[neighborKey];
+    for (size_t i = 0; i < ack->getOriginArraySize(); i++) {
+        uint32_t originKey = ack->getOrigin(i);
+        uint32_t seqNum = ack->getSeqNum(i);
+        uint32_t held = ack->getHeldSeqNum(i);
 
-            EV << "MecOspf:handleReceivedLsa - scheduled route recomputation at " << (lsaInstallTime + routeComputationDelay_) << "\n";
+        uint32_t &knownSeqNum = known[originKey];
+        knownSeqNum = max(knownSeqNum, held);
+
+        auto it = unacked.find(originKey);
+        if (it != unacked.end() && it->second.first <= seqNum)
+            unacked.erase(it);
+
+        if (held < seqNum) {
+            auto cached = lsaPacketCache_.find(originKey);
+            if (cached == lsaPacketCache_.end())
+                continue;
+            EV_INFO << "MecOspf:handleReceivedLsaAck - neighbor " << Ipv4Address(neighborKey) << " holds seqNum " << held
+                    << " of " << Ipv4Address(originKey) << ", delta " << seqNum << " not applied, send the full LSA\n";
+            queueLsa(cached->second, neighborKey);
         }
-        else if (routeComputationTimer_->isScheduled() && largestLsaTime_ < lsaInstallTime)
-        {
-            // if some LSA is generated at a later time, we can cancel and reschedule
-            // the routeComputationTimer_ to a later time to avoid multiple recomputations
-            largestLsaTime_ = lsaInstallTime;
-            cancelEvent(routeComputationTimer_);
-            scheduleAt(largestLsaTime_ + routeComputationDelay_, routeComputationTimer_);
+    }
+}
+
+
+/***
+ * === retransmitUnackedLsas ===
+ * Delta LSA mode: the packet or its acknowledgement was lost, resend our full copy of the origin's LSA.
+ */
+void MecOspf::retransmitUnackedLsas()
+{
+    simtime_t nextCheck = SIMTIME_MAX;
+    for (auto &kv : unackedLsas_) {
+        for (auto it = kv.second.begin(); it != kv.second.end(); ) {
+            if (simTime() - it->second.second < lsaRetransmitInterval_) {
+                nextCheck = min(nextCheck, it->second.second + lsaRetransmitInterval_);
+                ++it;
+                continue;
+            }
+
+            uint32_t originKey = it->first;
+            it = kv.second.erase(it);
+            auto cached = lsaPacketCache_.find(originKey);
+            if (cached == lsaPacketCache_.end() || neighbors_.find(kv.first) == neighbors_.end())
+                continue;
 
-            EV << "MecOspf:handleReceivedLsa - rescheduled route recomputation at " << (largestLsaTime_ + routeComputationDelay_) << "\n";
+            EV_INFO << "MecOspf:retransmitUnackedLsas - no acknowledgement from neighbor " << Ipv4Address(kv.first)
+                    << " for LSA of " << Ipv4Address(originKey) << ", resend the full LSA\n";
+            queueLsa(cached->second, kv.first);   // suppressed if the neighbor is known to have it meanwhile
         }
-    } else {
-        EV_INFO << "MecOspf:handleReceivedLsa - received old LSA from " << Ipv4Address(originKey) << ", ignore it!\n";
     }
+
+    if (nextCheck < SIMTIME_MAX && !lsaRetransmitTimer_->isScheduled())
+        scheduleAt(nextCheck, lsaRetransmitTimer_);
+}
+
+
+uint32_t MecOspf::findNeighborByInterface(int interfaceId)
+{
+    for (const auto& n : neighbors_) {
+        if (n.second.outInterface && n.second.outInterface->getInterfaceId() == interfaceId)
+            return n.first;
+    }
+    return 0;
+}
+
+
+void MecOspf::setLsaLength(OspfLsa& lsa)
+{
+    lsa.setChunkLength(B(25 + 12 * (int)lsa.getNeighborArraySize()));
 }
 
 
@@ -743,6 +1077,7 @@ void MecOspf::updateTopologyFromLsa(inet::Ptr<const OspfLsa>& lsa)
 
     int neighborCount = lsa->getNeighborArraySize();
     topology_[originKey].clear();
+    spfDirtyRows_.insert(originKey);
     for (int i = 0; i < neighborCount; i++) {
         uint32_t nbrKey = lsa->getNeighbor(i);
         double cost = lsa->getCost(i);
@@ -779,6 +1114,160 @@ void MecOspf::sendLsa(inet::Ptr<const OspfLsa> lsa, uint32_t neighborKey)
 }
 
 
+/***
+ * === makeDeltaLsa ===
+ * Build the delta from oldLsa to newLsa of the same origin: the added or changed adjacencies with
+ * their new cost, and the removed ones with a negative cost.
+ */
+inet::Ptr<OspfLsa> MecOspf::makeDeltaLsa(const OspfLsa& oldLsa, const OspfLsa& newLsa)
+{
+    map<uint32_t, double> oldAdj;
+    for (size_t i = 0; i < oldLsa.getNeighborArraySize(); i++)
+        oldAdj[oldLsa.getNeighbor(i)] = oldLsa.getCost(i);
+
+    auto delta = makeShared<OspfLsa>();
+    delta->setOrigin(newLsa.getOrigin());
+    delta->setNodeId(newLsa.getNodeId());
+    delta->setSeqNum(newLsa.getSeqNum());
+    delta->setInstallTime(newLsa.getInstallTime());
+    delta->setIsDelta(true);
+    delta->setBaseSeqNum(oldLsa.getSeqNum());
+    for (size_t i = 0; i < newLsa.getNeighborArraySize(); i++) {
+        auto it = oldAdj.find(newLsa.getNeighbor(i));
+        if (it == oldAdj.end() || it->second != newLsa.getCost(i)) {
+            delta->appendNeighbor(newLsa.getNeighbor(i));
+            delta->appendCost(newLsa.getCost(i));
+        }
+        if (it != oldAdj.end())
+            oldAdj.erase(it);
+    }
+    for (const auto& kv : oldAdj) {  // adjacencies no longer present
+        delta->appendNeighbor(kv.first);
+        delta->appendCost(-1.0);
+    }
+    setLsaLength(*delta);
+    return delta;
+}
+
+
+/***
+ * === applyDeltaLsa ===
+ * Apply a delta LSA to lsa, which can be a full LSA or another delta (merging two pending deltas).
+ * The result takes the seqNum and install time of the delta.
+ */
+void MecOspf::applyDeltaLsa(OspfLsa& lsa, const OspfLsa& delta)
+{
+    // keep the order of the adjacencies, appending the new ones
+    vector<pair<uint32_t, double>> adj;
+    for (size_t i = 0; i < lsa.getNeighborArraySize(); i++)
+        adj.push_back({lsa.getNeighbor(i), lsa.getCost(i)});
+
+    for (size_t i = 0; i < delta.getNeighborArraySize(); i++) {
+        uint32_t nbr = delta.getNeighbor(i);
+        double cost = delta.getCost(i);
+        auto it = find_if(adj.begin(), adj.end(), [nbr](const pair<uint32_t, double>& e) { return e.first == nbr; });
+        if (it != adj.end())
+            it->second = cost;
+        else
+            adj.push_back({nbr, cost});
+    }
+
+    // a full LSA drops the removed adjacencies, a delta keeps them as removal marks
+    if (!lsa.isDelta())
+        adj.erase(remove_if(adj.begin(), adj.end(), [](const pair<uint32_t, double>& e) { return e.second < 0; }), adj.end());
+
+    lsa.setNeighborArraySize(adj.size());
+    lsa.setCostArraySize(adj.size());
+    for (size_t i = 0; i < adj.size(); i++) {
+        lsa.setNeighbor(i, adj[i].first);
+        lsa.setCost(i, adj[i].second);
+    }
+    lsa.setSeqNum(delta.getSeqNum());
+    lsa.setInstallTime(delta.getInstallTime());
+    setLsaLength(lsa);
+}
+
+
+/***
+ * === queueLsa ===
+ * Delta LSA mode: put an LSA into the coalescing queue of a neighbor instead of sending it right away.
+ * - an LSA the neighbor is known to have (same origin, same or higher seqNum) is suppressed
+ * - a delta is replaced by our full copy if the neighbor is not known to have its base
+ * - a pending delta of the same origin is merged with the new one, so one LSA per origin is sent per window;
+ *   a pending full LSA is refreshed from our full copy, it may be older than the base of the new delta
+ */
+void MecOspf::queueLsa(inet::Ptr<const OspfLsa> lsa, uint32_t neighborKey)
+{
+    uint32_t originKey = lsa->getOrigin();
+    if (originKey == neighborKey)   // the origin has the newest version of its own LSA
+        return;
+
+    auto &known = neighborSeqNum_[neighborKey];
+    auto itKnown = known.find(originKey);
+    if (itKnown != known.end() && itKnown->second >= lsa->getSeqNum()) {
+        EV_DETAIL << "MecOspf:queueLsa - neighbor " << Ipv4Address(neighborKey) << " already has LSA (origin=" << Ipv4Address(originKey)
+                  << ", seqNum=" << lsa->getSeqNum() << "), suppressed\n";
+        return;
+    }
+
+    if (lsa->isDelta() && (itKnown == known.end() || itKnown->second < lsa->getBaseSeqNum())) {
+        auto cached = lsaPacketCache_.find(originKey);
+        if (cached == lsaPacketCache_.end() || cached->second->getSeqNum() != lsa->getSeqNum())
+            return; // sanity check, the cache is updated before forwarding
+        lsa = cached->second;
+    }
+
+    auto &pending = pendingLsas_[neighborKey];
+    auto it = pending.find(originKey);
+    if (it == pending.end() || !lsa->isDelta())
+        pending[originKey] = makeShared<OspfLsa>(*lsa);
+    else if (!it->second->isDelta() || it->second->getSeqNum() < lsa->getBaseSeqNum())
+        pending[originKey] = makeShared<OspfLsa>(*lsaPacketCache_[originKey]);     // pending full LSA or gap, send our full copy
+    else
+        applyDeltaLsa(*it->second, *lsa);   // merge the two pending deltas
+
+    if (!lsaFlushTimer_->isScheduled())
+        scheduleAt(simTime() + lsaCoalesceWindow_, lsaFlushTimer_);
+}
+
+
+/***
+ * === flushPendingLsas ===
+ * End of the coalescing window: send one packet per neighbor carrying all its pending LSAs.
+ */
+void MecOspf::flushPendingLsas()
+{
+    for (auto &kv : pendingLsas_) {
+        if (kv.second.empty())
+            continue;
+
+        auto it = neighbors_.find(kv.first);
+        if (it == neighbors_.end() || !it->second.outInterface || !it->second.outInterface->isUp()) {
+            kv.second.clear();
+            continue;
+        }
+        Neighbor &n = it->second;
+
+        Packet *lsaPkt = new Packet("OspfLsa");
+        // the neighbor is only known to have the LSAs once it acknowledges them
+        for (auto &entry : kv.second) {
+            lsaPkt->insertAtBack(entry.second);
+            unackedLsas_[kv.first][entry.first] = {entry.second->getSeqNum(), simTime()};
+        }
+        lsaPkt->addTagIfAbsent<InterfaceReq>()->setInterfaceId(n.outInterface->getInterfaceId());
+
+        EV_INFO << "MecOspf:flushPendingLsas - sending " << kv.second.size() << " LSAs to neighbor " << n.destIp
+                << " via interface " << n.outInterface->getInterfaceName() << "\n";
+
+        socket_.sendTo(lsaPkt, Ipv4Address::ALL_OSPF_ROUTERS_MCAST, MEC_OSPF_PORT);
+        kv.second.clear();
+    }
+
+    if (!lsaRetransmitTimer_->isScheduled())
+        scheduleAt(simTime() + lsaRetransmitInterval_, lsaRetransmitTimer_);
+}
+
+
 /* === checkNeighborTimeouts ===
  * Remove neighbors that haven't been heard from within neighborTimeout.
  */
@@ -798,7 +1287,23 @@ void MecOspf::checkNeighborTimeouts()
     for (auto key : toRemove) {
         Ipv4Address neighborIp = neighbors_[key].destIp;
         EV_WARN << "MecOspf:checkNeighborTimeouts - neighbor " << neighborIp << " timed out -> remove\n";
+
+        // indirect routes through this neighbor are broken, the others stay until the next route computation
+        const Neighbor &n = neighbors_[key];
+        for (auto it = indirectRoutes_.begin(); it != indirectRoutes_.end(); ) {
+            if (it->second->getGateway() == n.gateway && it->second->getInterface() == n.outInterface) {
+                Ipv4Route *route = rt_->removeRoute(it->second);
+                if (route != nullptr)
+                    delete route;
+                it = indirectRoutes_.erase(it);
+            }
+            else
+                ++it;
+        }
         neighbors_.erase(key);
+        pendingLsas_.erase(key);
+        neighborSeqNum_.erase(key);
+        unackedLsas_.erase(key);
         Ipv4Route *route = rt_->removeRoute(neighborRoutes_[key]);
         if (route != nullptr)
             delete route;
@@ -810,10 +1315,10 @@ void MecOspf::checkNeighborTimeouts()
     resetGlobalScheduler(); // reset global scheduler
 
     // start building new topology
-    clearIndirectRoutes();
     for (auto key : toRemove) {
         topology_[routerIdKey_].erase(key);
     }
+    spfDirtyRows_.insert(routerIdKey_);
 }
 
 /* === clearInstalledRoutes ===
@@ -847,8 +1352,10 @@ void MecOspf::clearNeighborRoutes()
 }
 
 /* === recomputeRouting ===
- * Run Dijkstra to compute shortest paths from ourself to all nodes in the topology.
- * Install indirect routes in the routing table accordingly (neighbor routes do not need to change).
+ * Update the shortest paths from ourself to all nodes in the topology.
+ * The shortest path tree is kept between runs and only the part affected by the changed
+ * rows of topology_ is recomputed. Only the indirect routes whose next hop changed are
+ * reinstalled in the routing table (neighbor routes do not need to change).
  */
 void MecOspf::recomputeIndirectRouting()
 {
@@ -857,84 +1364,41 @@ void MecOspf::recomputeIndirectRouting()
         return;
     }
 
-    EV_INFO << "MecOspf::recomputeIndirectRouting - Run Dijkstra to determine updated indirect routes\n";
-
-    // ======== Step 1: clear previously installed indirect routes ========
-    clearIndirectRoutes();
-
-    // ======== Step 2: Dijkstra's algorithm to find shortest paths from routerIdKey_ to all other nodes ========
-    // initialize node infos
-    std::map<uint32_t, Node> nodeInfos;
-    for (const auto& kv : topology_) {
-        uint32_t nodeKey = kv.first;
-        nodeInfos[nodeKey] = {nodeKey, INFINITY, 0, false};
-        if (nodeKey == routerIdKey_) {
-            nodeInfos[nodeKey].cost = 0.0; // cost to self is 0
-        }
+    // ======== Step 1: update the shortest path tree ========
+    if (!spfValid_ || !repairSpf())
+    {
+        EV_INFO << "MecOspf::recomputeIndirectRouting - Run full Dijkstra to determine indirect routes\n";
+        rebuildSpf();
+    }
+    else
+    {
+        EV_INFO << "MecOspf::recomputeIndirectRouting - shortest path tree repaired incrementally\n";
     }
 
-    dijkstra(routerIdKey_, nodeInfos);
-
-    // ======== Step 3: extract next-hop routing table from Dijkstra results ========
-    vector<uint32_t> reachableNodes = {routerIdKey_};    // in case the topology is partitioned
-    // For each destination, we backtrack the predecessor chain until we reach the direct neighbor of routerIdKey_.
-    for (const auto& kv : nodeInfos) {
-        uint32_t dest = kv.first;
-        if (dest == routerIdKey_) continue;  // skip self
+    // unreachable nodes are removed from the topology (in case the topology is partitioned)
+    vector<uint32_t> reachableNodes = {routerIdKey_};
+    for (size_t i = 0; i < spfKeys_.size(); i++) {
+        uint32_t dest = spfKeys_[i];
+        if (!spfActive_[i] || dest == routerIdKey_) continue;
 
-        // Unreachable?
-        if (kv.second.cost == INFINITY || kv.second.prevHop == 0) {
+        if (spfDist_[i] == INFINITY) {
             EV_INFO << "Destination " << Ipv4Address(dest) << " is unreachable\n";
             topology_.erase(dest); // remove unreachable node from topology
             lsaPacketCache_.erase(dest); // remove its LSA from cache
+            spfActive_[i] = false;
+            for (int v = 0; v < spfCapacity_; v++)
+                spfCost(i, v) = INFINITY;
             continue;
         }
-
         reachableNodes.push_back(dest);
-        // Backtrack from dest to source
-        uint32_t current = dest;
-        uint32_t prev = nodeInfos[current].prevHop;
-
-        // skip if direct neighbor
-        if (prev == routerIdKey_) continue;
-
-        // Walk backwards until the predecessor is the source
-        EV_INFO << "Path to " << Ipv4Address(dest) << ": " << Ipv4Address(current);
-        while (prev != 0 && prev != routerIdKey_) {
-            current = prev;
-            prev = nodeInfos[current].prevHop;
-            EV_INFO << " <- " << Ipv4Address(current);
-        }
-        EV_INFO << " <- " << Ipv4Address(prev);
-        EV_INFO << " (cost=" << kv.second.cost << ")\n";
-
-        // Add the next hop route into the routing table
-        // current is now the first hop on the path from routerIdKey_ to dest
-        if (prev == routerIdKey_) {
-            // add routes to the routingTable
-            auto it = neighbors_.find(current);
-            if (it == neighbors_.end()) {
-                EV_WARN << "MecOspf:recomputeIndirectRouting - next hop neighbor " << Ipv4Address(current) << " not found in neighbors, skip route to "
-                        << Ipv4Address(dest) << "\n";
-                continue;
-            }
-            Neighbor &n = it->second;
-            if (rt_) {
-                Ipv4Route *route = new Ipv4Route();
-                route->setDestination(Ipv4Address(dest));
-                route->setNetmask(Ipv4Address::ALLONES_ADDRESS); // host route
-                route->setGateway(n.gateway);
-                route->setInterface(n.outInterface);
-                route->setSourceType(Ipv4Route::OSPF);
-                route->setMetric(1);
-                rt_->addRoute(route);
-                indirectRoutes_[dest] = route;
-                EV_INFO << "MecOspf:processHello - added indirect route to node " << Ipv4Address(dest) << "\n";
-            }
-        }
     }
 
-    // ======= Step 4: determine the scheduler node ========
+    // ======== Step 2: install the routes whose next hop changed ========
+    if (enableLfa_)
+        computeLfaBackups();
+    updateIndirectRoutes();
+
+    // ======= Step 3: determine the scheduler node ========
     // select the reachable node with maximum number of neighbors as the scheduler
     // (if multiple, select the one with the lowest IP address) 
     size_t maxNeighbors = 0;
@@ -981,37 +1445,475 @@ void MecOspf::recomputeIndirectRouting()
 }
 
 
-void MecOspf::dijkstra(uint32_t source, std::map<uint32_t, Node>& nodeInfos)
+int MecOspf::spfAddNode(uint32_t key)
+{
+    auto it = spfIndex_.find(key);
+    if (it != spfIndex_.end())
+        return it->second;
+
+    int idx = spfKeys_.size();
+    if (idx >= spfCapacity_) {
+        // grow the dense adjacency, keeping the existing links
+        int newCapacity = max(16, 2 * spfCapacity_);
+        vector<double> adj((size_t)newCapacity * newCapacity, INFINITY);
+        for (int u = 0; u < idx; u++)
+            for (int v = 0; v < idx; v++)
+                adj[(size_t)u * newCapacity + v] = spfCost(u, v);
+        spfAdj_.swap(adj);
+        spfCapacity_ = newCapacity;
+    }
+
+    spfIndex_[key] = idx;
+    spfKeys_.push_back(key);
+    spfActive_.push_back(false);
+    spfDist_.push_back(INFINITY);
+    spfParent_.push_back(-1);
+    return idx;
+}
+
+
+void MecOspf::rebuildSpf()
+{
+    spfIndex_.clear();
+    spfKeys_.clear();
+    spfActive_.clear();
+    spfDist_.clear();
+    spfParent_.clear();
+    spfCapacity_ = 0;
+    spfAdj_.clear();
+    spfDirtyRows_.clear();
+
+    // only the routers having an entry in topology_ take part in the computation
+    for (const auto& kv : topology_)
+        spfActive_[spfAddNode(kv.first)] = true;
+
+    for (const auto& kv : topology_) {
+        int u = spfIndex_[kv.first];
+        for (const auto& nbr : kv.second) {
+            auto it = spfIndex_.find(nbr.first);
+            if (it != spfIndex_.end())
+                spfCost(u, it->second) = nbr.second;
+        }
+    }
+
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq;
+    int source = spfIndex_[routerIdKey_];
+    spfDist_[source] = 0.0;
+    pq.push({0.0, source});
+    runSpf(pq);
+
+    spfValid_ = true;
+}
+
+
+/***
+ * === repairSpf ===
+ * Dynamic single-source shortest paths (in the spirit of Ramalingam and Reps).
+ * 1. Links that got worse (or removed) on the tree detach the subtree below them, these nodes lose their distance.
+ * 2. Each detached node restarts from its best link from an intact node.
+ * 3. Links that got better (or added) may shorten the path of their head node.
+ * 4. Dijkstra from the touched nodes only propagates the changes as far as they go.
+ * Returns false if the set of routers changed, the caller then rebuilds the tree.
+ */
+bool MecOspf::repairSpf()
+{
+    if (spfDirtyRows_.empty())
+        return true;
+
+    // a router joined or left the topology
+    for (auto key : spfDirtyRows_) {
+        auto it = spfIndex_.find(key);
+        bool inTopology = topology_.find(key) != topology_.end();
+        if (it == spfIndex_.end() ? inTopology : (spfActive_[it->second] != inTopology))
+            return false;
+    }
+
+    // diff the dirty rows against the dense adjacency
+    vector<pair<int, int>> increased, decreased;
+    for (auto key : spfDirtyRows_) {
+        auto itRow = spfIndex_.find(key);
+        if (itRow == spfIndex_.end()) continue; // neither indexed nor in topology_
+        int u = itRow->second;
+        if (!spfActive_[u]) continue;
+
+        vector<double> row(spfCapacity_, INFINITY);
+        for (const auto& nbr : topology_[key]) {
+            auto it = spfIndex_.find(nbr.first);
+            if (it != spfIndex_.end())
+                row[it->second] = nbr.second;
+        }
+        for (int v = 0; v < (int)spfKeys_.size(); v++) {
+            if (row[v] == spfCost(u, v)) continue;
+            if (row[v] > spfCost(u, v))
+                increased.push_back({u, v});
+            else
+                decreased.push_back({u, v});
+            spfCost(u, v) = row[v];
+        }
+    }
+    spfDirtyRows_.clear();
+
+    int n = spfKeys_.size();
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq;
+
+    // Step 1: detach the subtrees hanging below tree links that got worse
+    vector<bool> affected(n, false);
+    vector<int> stack;
+    for (const auto& e : increased) {
+        if (spfParent_[e.second] == e.first && !affected[e.second]) {
+            affected[e.second] = true;
+            stack.push_back(e.second);
+        }
+    }
+    if (!stack.empty()) {
+        vector<vector<int>> children(n);
+        for (int v = 0; v < n; v++)
+            if (spfParent_[v] >= 0)
+                children[spfParent_[v]].push_back(v);
+
+        vector<int> detached;
+        while (!stack.empty()) {
+            int v = stack.back();
+            stack.pop_back();
+            detached.push_back(v);
+            for (int c : children[v]) {
+                if (!affected[c]) {
+                    affected[c] = true;
+                    stack.push_back(c);
+                }
+            }
+        }
+        for (int v : detached) {
+            spfDist_[v] = INFINITY;
+            spfParent_[v] = -1;
+        }
+
+        // Step 2: best link from the intact part of the tree
+        for (int v : detached) {
+            for (int u = 0; u < n; u++) {
+                if (!spfActive_[u] || affected[u] || spfDist_[u] == INFINITY) continue;
+                double cost = spfCost(u, v);
+                if (cost != INFINITY && spfDist_[u] + cost < spfDist_[v]) {
+                    spfDist_[v] = spfDist_[u] + cost;
+                    spfParent_[v] = u;
+                }
+            }
+            if (spfDist_[v] != INFINITY)
+                pq.push({spfDist_[v], v});
+        }
+    }
+
+    // Step 3: links that got better
+    for (const auto& e : decreased) {
+        int u = e.first, v = e.second;
+        if (!spfActive_[v] || spfDist_[u] == INFINITY) continue;
+        if (spfDist_[u] + spfCost(u, v) < spfDist_[v]) {
+            spfDist_[v] = spfDist_[u] + spfCost(u, v);
+            spfParent_[v] = u;
+            pq.push({spfDist_[v], v});
+        }
+    }
+
+    // Step 4: propagate
+    runSpf(pq);
+    return true;
+}
+
+
+void MecOspf::runSpf(priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>>& pq)
+{
+    int n = spfKeys_.size();
+    while (!pq.empty()) {
+        auto top = pq.top();
+        pq.pop();
+        int u = top.second;
+        if (top.first > spfDist_[u]) continue;     // skip stale entries
+
+        for (int v = 0; v < n; v++) {
+            double cost = spfCost(u, v);
+            if (cost == INFINITY || !spfActive_[v]) continue;
+            if (spfDist_[u] + cost < spfDist_[v]) {
+                spfDist_[v] = spfDist_[u] + cost;
+                spfParent_[v] = u;
+                pq.push({spfDist_[v], v});
+            }
+        }
+    }
+}
+
+
+/***
+ * First hop (index of a direct neighbor) of every reachable destination in the shortest path tree, -1 otherwise.
+ */
+vector<int> MecOspf::computeFirstHops()
+{
+    int n = spfKeys_.size();
+    int source = spfIndex_[routerIdKey_];
+
+    vector<int> firstHop(n, -1);
+    for (int v = 0; v < n; v++) {
+        if (v == source || !spfActive_[v] || spfDist_[v] == INFINITY) continue;
+        vector<int> path;
+        int cur = v;
+        while (cur >= 0 && firstHop[cur] < 0 && spfParent_[cur] != source) {
+            path.push_back(cur);
+            cur = spfParent_[cur];
+        }
+        int hop = (cur < 0) ? -1 : (firstHop[cur] >= 0 ? firstHop[cur] : cur);
+        if (cur >= 0)
+            firstHop[cur] = hop;
+        for (int p : path)
+            firstHop[p] = hop;
+    }
+    return firstHop;
+}
+
+
+/***
+ * === updateIndirectRoutes ===
+ * Derive the first hop of every reachable destination from the shortest path tree and
+ * only touch the routes in the routing table whose next hop is new or has changed.
+ */
+void MecOspf::updateIndirectRoutes()
+{
+    int n = spfKeys_.size();
+    int source = spfIndex_[routerIdKey_];
+    vector<int> firstHop = computeFirstHops();
+
+    // indirect routes we want, keyed by destination
+    map<uint32_t, const Neighbor*> wanted;
+    for (int v = 0; v < n; v++) {
+        if (firstHop[v] < 0 || spfParent_[v] == source) continue;  // unreachable or direct neighbor
+
+        uint32_t dest = spfKeys_[v];
+        auto it = neighbors_.find(spfKeys_[firstHop[v]]);
+        if (it == neighbors_.end()) {
+            EV_WARN << "MecOspf:updateIndirectRoutes - next hop neighbor " << Ipv4Address(spfKeys_[firstHop[v]]) << " not found in neighbors, skip route to "
+                    << Ipv4Address(dest) << "\n";
+            continue;
+        }
+
+        // keep using the backup while the link to the primary next hop is down
+        const Neighbor *backup = findUsableBackup(dest, it->second);
+        wanted[dest] = backup ? backup : &it->second;
+    }
+
+    // remove routes that are no longer needed or have a different next hop
+    int removed = 0, added = 0;
+    for (auto it = indirectRoutes_.begin(); it != indirectRoutes_.end(); ) {
+        auto itWanted = wanted.find(it->first);
+        if (itWanted != wanted.end() && it->second->getGateway() == itWanted->second->gateway
+                && it->second->getInterface() == itWanted->second->outInterface) {
+            wanted.erase(itWanted);     // unchanged, keep the installed route
+            ++it;
+            continue;
+        }
+
+        Ipv4Route *route = rt_->removeRoute(it->second);
+        if (route != nullptr)
+            delete route;
+        it = indirectRoutes_.erase(it);
+        removed++;
+    }
+
+    // install the new routes
+    for (const auto& kv : wanted) {
+        Ipv4Route *route = new Ipv4Route();
+        route->setDestination(Ipv4Address(kv.first));
+        route->setNetmask(Ipv4Address::ALLONES_ADDRESS); // host route
+        route->setGateway(kv.second->gateway);
+        route->setInterface(kv.second->outInterface);
+        route->setSourceType(Ipv4Route::OSPF);
+        route->setMetric(1);
+        rt_->addRoute(route);
+        indirectRoutes_[kv.first] = route;
+        added++;
+        EV_INFO << "MecOspf:updateIndirectRoutes - route to node " << Ipv4Address(kv.first) << " via " << kv.second->destIp << "\n";
+    }
+
+    EV_INFO << "MecOspf:updateIndirectRoutes - " << added << " routes installed, " << removed << " routes removed, "
+            << indirectRoutes_.size() << " indirect routes in total\n";
+}
+
+
+/***
+ * === computeLfaBackups ===
+ * Loop-free alternates (RFC 5286): for each destination D, a neighbor N other than the primary next hop,
+ * reached over another interface, is a safe backup if dist(N, D) < dist(N, S) + dist(S, D), i.e. N does
+ * not route back through us. The one with the shortest path through it is kept.
+ */
+void MecOspf::computeLfaBackups()
+{
+    lfaBackup_.clear();
+
+    int n = spfKeys_.size();
+    int source = spfIndex_[routerIdKey_];
+    vector<int> firstHop = computeFirstHops();
+
+    // shortest distances from each neighbor
+    map<uint32_t, vector<double>> nbrDist;
+    for (const auto& kv : neighbors_) {
+        auto it = spfIndex_.find(kv.first);
+        if (it == spfIndex_.end() || !spfActive_[it->second]) continue;
+        spfFrom(it->second, nbrDist[kv.first]);
+    }
+
+    for (int v = 0; v < n; v++) {
+        if (firstHop[v] < 0) continue;  // self or unreachable
+
+        auto itPrimary = neighbors_.find(spfKeys_[firstHop[v]]);
+        if (itPrimary == neighbors_.end()) continue;
+
+        uint32_t bestKey = 0;
+        double bestCost = INFINITY;
+        for (const auto& kv : nbrDist) {
+            const Neighbor &nb = neighbors_[kv.first];
+            if (kv.first == itPrimary->first || nb.outInterface == itPrimary->second.outInterface) continue;
+
+            const vector<double>& dist = kv.second;
+            if (dist[v] == INFINITY || !(dist[v] < dist[source] + spfDist_[v])) continue; // not loop-free
+
+            double cost = spfCost(source, spfIndex_[kv.first]) + dist[v];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestKey = kv.first;
+            }
+        }
+        if (bestKey != 0)
+            lfaBackup_[spfKeys_[v]] = bestKey;
+    }
+
+    EV_INFO << "MecOspf:computeLfaBackups - loop-free alternates found for " << lfaBackup_.size() << " destinations\n";
+}
+
+
+void MecOspf::spfFrom(int root, vector<double>& dist)
 {
-    // Initialize priority queue
-    auto cmp = [](const Node* a, const Node* b) { return a->cost > b->cost; };
-    std::priority_queue<Node*, std::vector<Node*>, decltype(cmp)> pq(cmp);
+    int n = spfKeys_.size();
+    dist.assign(n, INFINITY);
+    dist[root] = 0.0;
 
-    // Start from source
-    pq.push(&nodeInfos[source]);
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq;
+    pq.push({0.0, root});
     while (!pq.empty()) {
-        Node* current = pq.top();
+        auto top = pq.top();
         pq.pop();
-        if (current->visited) continue;     // skip stale entries
-        current->visited = true;
-
-        // Explore neighbors
-        for (const auto& neighborKv : topology_[current->nodeKey]) {
-            uint32_t neighborKey = neighborKv.first;
-            double linkCost = neighborKv.second;
-            if (nodeInfos.find(neighborKey) == nodeInfos.end()) continue; // unknown node
-
-            Node &neighborInfo = nodeInfos[neighborKey];
-            if (current->cost + linkCost < neighborInfo.cost) {
-                neighborInfo.cost = current->cost + linkCost;
-                neighborInfo.prevHop = current->nodeKey;
-                pq.push(&neighborInfo);
+        int u = top.second;
+        if (top.first > dist[u]) continue;     // skip stale entries
+
+        for (int v = 0; v < n; v++) {
+            double cost = spfCost(u, v);
+            if (cost == INFINITY || !spfActive_[v]) continue;
+            if (dist[u] + cost < dist[v]) {
+                dist[v] = dist[u] + cost;
+                pq.push({dist[v], v});
             }
         }
     }
 }
 
 
+/***
+ * Returns the backup neighbor for dest if the link to its primary next hop is down, nullptr otherwise.
+ */
+const MecOspf::Neighbor *MecOspf::findUsableBackup(uint32_t dest, const Neighbor& primary)
+{
+    if (!enableLfa_ || !primary.outInterface || failedIfIds_.count(primary.outInterface->getInterfaceId()) == 0)
+        return nullptr;
+
+    auto itBackup = lfaBackup_.find(dest);
+    if (itBackup == lfaBackup_.end())
+        return nullptr;
+
+    auto it = neighbors_.find(itBackup->second);
+    if (it == neighbors_.end() || !it->second.outInterface || !it->second.outInterface->isUp()
+            || failedIfIds_.count(it->second.outInterface->getInterfaceId()))
+        return nullptr;
+
+    return &it->second;
+}
+
+
+/***
+ * === handleLinkDown ===
+ * Called when the link behind a local interface fails. The routes using it are switched to their
+ * loop-free alternate right away, before Hello times out and the new topology is flooded.
+ * The route computation that follows reconciles the routes with the new topology.
+ * Loss of carrier is seen at both ends of a link, so the router at the other end is informed as well.
+ */
+void MecOspf::handleLinkDown(NetworkInterface *ie, bool notifyPeer)
+{
+    Enter_Method("handleLinkDown");
+
+    if (!enableLfa_ || !routeUpdate_ || !ie)
+        return;
+
+    int ifId = ie->getInterfaceId();
+    failedIfIds_.insert(ifId);
+
+    int switched = 0;
+    auto switchRoute = [&](uint32_t dest, Ipv4Route *route) {
+        if (!route || !route->getInterface() || route->getInterface()->getInterfaceId() != ifId)
+            return;
+        auto itBackup = lfaBackup_.find(dest);
+        if (itBackup == lfaBackup_.end())
+            return;
+        auto it = neighbors_.find(itBackup->second);
+        if (it == neighbors_.end() || !it->second.outInterface || failedIfIds_.count(it->second.outInterface->getInterfaceId()))
+            return;
+        route->setGateway(it->second.gateway);
+        route->setInterface(it->second.outInterface);
+        switched++;
+    };
+    for (auto& kv : indirectRoutes_)
+        switchRoute(kv.first, kv.second);
+    for (auto& kv : neighborRoutes_)
+        switchRoute(kv.first, kv.second);
+
+    EV_INFO << "MecOspf:handleLinkDown - link on interface " << ie->getInterfaceName() << " is down, "
+            << switched << " routes switched to loop-free alternates\n";
+
+    if (notifyPeer) {
+        NetworkInterface *peerIf = findPeerInterface(ie);
+        MecOspf *peer = peerIf ? findOspfInNode(findContainingNode(peerIf)) : nullptr;
+        if (peer)
+            peer->handleLinkDown(peerIf, false);
+    }
+}
+
+
+/***
+ * === handleLinkUp ===
+ * Called when the link behind a local interface recovers. Routes switched to a backup go back to
+ * their primary next hop if the neighbor has not timed out meanwhile.
+ */
+void MecOspf::handleLinkUp(NetworkInterface *ie, bool notifyPeer)
+{
+    Enter_Method("handleLinkUp");
+
+    if (!ie || failedIfIds_.erase(ie->getInterfaceId()) == 0)
+        return;
+
+    for (auto& kv : neighborRoutes_) {
+        auto it = neighbors_.find(kv.first);
+        if (it == neighbors_.end() || kv.second->getInterface() == it->second.outInterface) continue;
+        kv.second->setGateway(it->second.gateway);
+        kv.second->setInterface(it->second.outInterface);
+    }
+    if (spfValid_)
+        updateIndirectRoutes();
+
+    EV_INFO << "MecOspf:handleLinkUp - link on interface " << ie->getInterfaceName() << " recovered, primary routes restored\n";
+
+    if (notifyPeer) {
+        NetworkInterface *peerIf = findPeerInterface(ie);
+        MecOspf *peer = peerIf ? findOspfInNode(findContainingNode(peerIf)) : nullptr;
+        if (peer)
+            peer->handleLinkUp(peerIf, false);
+    }
+}
+
+
 void MecOspf::updateAdjListToScheduler()
 {
     if (globalSchedulerReady_ && nodeInfo_ && nodeInfo_->getIsGlobalScheduler())
@@ -1080,6 +1982,13 @@ void MecOspf::handleNodeFailure()
         cancelEvent(lsaTimer_);
     if (routeComputationTimer_->isScheduled())
         cancelEvent(routeComputationTimer_);
+    if (lsaFlushTimer_->isScheduled())
+        cancelEvent(lsaFlushTimer_);
+    if (lsaRetransmitTimer_->isScheduled())
+        cancelEvent(lsaRetransmitTimer_);
+    pendingLsas_.clear();
+    neighborSeqNum_.clear();
+    unackedLsas_.clear();
     
     // clear all routes
     clearIndirectRoutes();
@@ -1089,6 +1998,9 @@ void MecOspf::handleNodeFailure()
     neighbors_.clear();
     neighborChanged_ = true;
     topology_[routerIdKey_].clear();
+    spfValid_ = false;  // rebuild the shortest path tree from scratch after recovery
+    lfaBackup_.clear();
+    failedIfIds_.clear();
     globalSchedulerReady_ = false;
     schedulerAddr_ = Ipv4Address::UNSPECIFIED_ADDRESS;
 }
@@ -44,6 +44,8 @@
 #include "inet/networklayer/ipv4/Ipv4Route.h"
 #include <vector>
 #include <unordered_map>
+#include <set>
+#include <queue>
 
 #include "mecrt/packets/routing/OspfLsa_m.h"
 #include "mecrt/common/MecCommon.h"
@@ -77,13 +79,6 @@ class MecOspf : public omnetpp::cSimpleModule
         Neighbor() = default;
     };
 
-    // for Dijkstra algorithm
-    struct Node {
-        uint32_t nodeKey;   // node ID (router)
-        double cost;        // tentative distance
-        uint32_t prevHop;   // previous hop in the path
-        bool visited;       // has the shortest path been finalized?
-    };
 
 	bool enableInitDebug_ = false;
 
@@ -92,6 +87,11 @@ class MecOspf : public omnetpp::cSimpleModule
     
     bool routeUpdate_ = true;
 
+    // bootstrap mode: build neighbors, LSA database and routes from the wired topology during initialization
+    // instead of running Hello discovery and LSA flooding at startup; Hello is then used for failure detection only
+    bool bootstrapTopology_ = false;
+    static map<cModule*, MecOspf*> bootstrapRouters_; // OSPF instances taking part in the bootstrap, keyed by their host node
+
     int localPort_;
     inet::UdpSocket socket_;
     int socketId_ = -1;
@@ -135,6 +135,32 @@ class MecOspf : public omnetpp::cSimpleModule
     simtime_t routeComputationDelay_ = 0.01; // seconds, wait time before recomputing routes after LSA update
     simtime_t largestLsaTime_ = 0; // track the largest LSA install time we have seen (to ensure LSA propagation is done before recomputing routes)
 
+    // incremental SPF state, the shortest path tree is repaired only where the topology changed
+    bool spfValid_ = false;             // whether the arrays below match topology_ (except the dirty rows)
+    unordered_map<uint32_t, int> spfIndex_; // router key -> index in the dense arrays
+    vector<uint32_t> spfKeys_;          // index -> router key
+    vector<bool> spfActive_;            // whether the router at this index is in topology_
+    int spfCapacity_ = 0;               // row length of spfAdj_
+    vector<double> spfAdj_;             // dense adjacency, spfAdj_[u * spfCapacity_ + v] = cost, INFINITY if no link
+    vector<double> spfDist_;            // distance from this router
+    vector<int> spfParent_;             // predecessor in the shortest path tree, -1 if none
+    set<uint32_t> spfDirtyRows_;        // routers whose adjacency in topology_ changed since the last SPF run
+
+    // loop-free alternates, used between a local link failure and the next route computation
+    bool enableLfa_ = false;
+    map<uint32_t, uint32_t> lfaBackup_; // destination key -> backup neighbor key
+    set<int> failedIfIds_;              // local interfaces whose link is down
+
+    // ======= delta LSA flooding =======
+    bool deltaLsa_ = false;             // flood only the changed adjacencies, coalesced per neighbor
+    simtime_t lsaCoalesceWindow_ = 0.002; // seconds, LSAs queued for a neighbor within this window are sent in one packet
+    simtime_t lsaRetransmitInterval_ = 0.02; // seconds, an LSA not acknowledged within this interval is resent in full
+    cMessage *lsaFlushTimer_ = nullptr;
+    cMessage *lsaRetransmitTimer_ = nullptr;
+    map<uint32_t, map<uint32_t, inet::Ptr<OspfLsa>>> pendingLsas_; // neighbor key -> origin key -> LSA waiting for the flush
+    map<uint32_t, map<uint32_t, uint32_t>> neighborSeqNum_; // neighbor key -> origin key -> highest seqNum the neighbor is confirmed to have
+    map<uint32_t, map<uint32_t, pair<uint32_t, simtime_t>>> unackedLsas_; // neighbor key -> origin key -> {seqNum sent, send time}
+
     // ======= Phrase 4: determine the scheduler node =======
     Ipv4Address schedulerAddr_ = Ipv4Address::UNSPECIFIED_ADDRESS;
     bool globalSchedulerReady_ = false; // whether the global scheduler is ready (if not, no cannot start scheduling)
@@ -160,26 +186,54 @@ class MecOspf : public omnetpp::cSimpleModule
 
 	// ====== LSA protocol (not used now) ======
     virtual void handleSelfLsaTimer();                                 // handle LSA timer firing
-	virtual void updateLsaToNetwork();                             // update our own LSA to the whole network
+	virtual void updateLsaToNetwork(inet::Ptr<const OspfLsa> delta = nullptr); // update our own LSA to the whole network
 	virtual void handleReceivedLsa(Packet *packet);                        // handle incoming LSA packets
     virtual void sendLsa(inet::Ptr<const OspfLsa> lsa, uint32_t neighborKey); // send LSA to a specific neighbor
     virtual void updateTopologyFromLsa(inet::Ptr<const OspfLsa>& lsa); // update our topology graph from a received LSA
+    virtual void scheduleRouteComputation(simtime_t lsaInstallTime); // schedule the route computation after an LSA update
+
+    // ====== delta LSA ======
+    inet::Ptr<OspfLsa> makeDeltaLsa(const OspfLsa& oldLsa, const OspfLsa& newLsa); // changed adjacencies between two LSAs
+    void applyDeltaLsa(OspfLsa& lsa, const OspfLsa& delta);  // apply (or merge) a delta LSA
+    virtual void queueLsa(inet::Ptr<const OspfLsa> lsa, uint32_t neighborKey); // queue an LSA for the next flush to a neighbor
+    virtual void flushPendingLsas();    // send the queued LSAs, one packet per neighbor
+    virtual void handleReceivedLsaAck(Packet *packet);  // record what the neighbor holds, answer a base mismatch with the full LSA
+    virtual void retransmitUnackedLsas();   // resend the full LSAs whose acknowledgement is overdue
+    uint32_t findNeighborByInterface(int interfaceId);  // neighbor key behind a local interface, 0 if none
+    void setLsaLength(OspfLsa& lsa);    // chunk length from the number of adjacencies carried
 
     // neighbor / failure
     virtual void checkNeighborTimeouts();
 
     // routing / SPF
-    virtual void recomputeIndirectRouting();     // build graph, Dijkstra, install routes
-    virtual void dijkstra(uint32_t source, map<uint32_t, Node>& nodeInfos); // Dijkstra algorithm
+    virtual void recomputeIndirectRouting();     // update the shortest path tree, install changed routes
+    virtual void rebuildSpf();                   // index topology_ and run a full Dijkstra
+    virtual bool repairSpf();                    // apply the dirty rows of topology_ to the shortest path tree
+    virtual void runSpf(priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>>& pq); // Dijkstra from the queued nodes
+    virtual void updateIndirectRoutes();         // diff the next hops against the installed routes
+    int spfAddNode(uint32_t key);                // index a router, growing the dense arrays if needed
+    double& spfCost(int u, int v) { return spfAdj_[(size_t)u * spfCapacity_ + v]; }
+    vector<int> computeFirstHops();              // first hop of each destination in the shortest path tree
+    virtual void computeLfaBackups();            // loop-free alternate next hop of each destination
+    void spfFrom(int root, vector<double>& dist); // full Dijkstra from another router
+    const Neighbor *findUsableBackup(uint32_t dest, const Neighbor& primary); // backup if the primary link is down
     virtual void clearIndirectRoutes();          // remove routes we previously added
     virtual void clearNeighborRoutes();          // remove direct neighbor routes
     virtual void updateAdjListToScheduler(); // inform the scheduler about our current adjacency list
 
     virtual void distInitializeLocalScheduler(); // initialize the local scheduler (if in distributed scheduling scheme)
 
+    // ====== bootstrap mode ======
+    virtual void bootstrapNeighbors();  // discover neighbors from the links of this node and fill our own LSA
+    virtual void bootstrapTopology();   // load the LSAs of all other routers and schedule the route computation
+    void addNeighborRoute(uint32_t key, const Neighbor& n); // install the host route to a direct neighbor
+    void refreshSelfLsa();              // write the current neighbor list into our own LSA with a new seqNum
+
     // helpers
     uint32_t ipKey(const Ipv4Address &a) const { return a.getInt(); }
     Ipv4Address getLocalAddressOnGate(cGate *gate);   // get local IP associated with a gate
+    NetworkInterface *findPeerInterface(NetworkInterface *ie); // interface at the other end of a wired link
+    static MecOspf *findOspfInNode(cModule *node);    // MecOspf instance in a node, if any
     virtual void resetGlobalScheduler(); // reset the global scheduler info
 
   public:
@@ -188,6 +242,8 @@ class MecOspf : public omnetpp::cSimpleModule
 
     virtual void handleNodeFailure(); // actions in case of node failure
     virtual void recoverFromErrors(); // actions to recover from errors
+    virtual void handleLinkDown(NetworkInterface *ie, bool notifyPeer = true); // switch routes over a failed link to their backup
+    virtual void handleLinkUp(NetworkInterface *ie, bool notifyPeer = true);   // restore the primary routes over a recovered link
     bool getRouteUpdate() { return routeUpdate_; }
     void setRouteUpdate(bool val) { routeUpdate_ = val; }
 };
@@ -0,0 +1,202 @@
+//
+//  Project: mecRT – Mobile Edge Computing Simulator for Real-Time Applications
+//  File:    tbsBench.cc
+//
+//  Description:
+//    Standalone microbenchmark of the TBS computation of MecNRAmc (src/mecrt/nic/mac/amc/MecTbs.h).
+//    Over the full key range (every MCS of TS 38.214 Tables 5.1.3.1-1 and 5.1.3.1-2, 1-8 layers,
+//    1-14 symbols per slot, 1-275 blocks, and every integer N_info up to 4 x 3824) it checks that
+//      - the direct path (compile-time N_info table) and
+//      - the memoized path (MecTbsCache, as used by MecNRAmc::getCodewordTbs)
+//    return the same TBS as the original simu5g path (NRAmc::computeCodewordTbs / computeTbsFromNinfo,
+//    copied below as the reference), then times the three paths.
+//
+//    Build and run (no OMNeT++ needed): cd tools/tbsBench && make run
+//    The exit code is 1 if any TBS differs from the reference.
+//
+//  Author:  Gao Chuanchao (Nanyang Technological University)
+//  Date:    2025-09-01
+//
+//  License: Academic Public License -- NOT FOR COMMERCIAL USE
+//
+
+#include "mecrt/nic/mac/amc/MecTbs.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace std;
+
+/***
+ * reference: the original simu5g computation, floor/log2 quantization and a linear scan over the table,
+ * the layers vector is copied for every codeword as in NRAmc::computeCodewordTbs.
+ * C is kept at least 1 as in MecTbs.h, simu5g divides by zero there.
+ */
+static unsigned int refTbsFromNinfo(double nInfo, double coderate)
+{
+    unsigned int tbs = 0;
+    unsigned int _nInfo = 0;
+    unsigned int n = 0;
+    if (nInfo == 0)
+        return 0;
+
+    if (nInfo <= 3824)
+    {
+        n = max((int)3, (int)(floor(log2(nInfo) - 6)));
+        _nInfo = max((unsigned int)24, (unsigned int)((1 << n) * floor(nInfo / (1 << n))));
+
+        unsigned int j = 0;
+        for (j = 0; j < MEC_NINFO_TO_TBS_SIZE - 1; j++)
+        {
+            if (MEC_NINFO_TO_TBS[j] >= _nInfo)
+                break;
+        }
+        tbs = MEC_NINFO_TO_TBS[j];
+    }
+    else
+    {
+        unsigned int C;
+        n = floor( log2(nInfo - 24) - 5);
+        _nInfo = ( 1 << n ) * round( (nInfo - 24) / (1 << n));
+        if (coderate <= 0.25 )
+        {
+            C = ceil( (_nInfo+24) / 3816 );
+            if (C == 0)     // the integer division gives 0 for N'_info + 24 < 3816, i.e., N_info just above 3824
+                C = 1;
+            tbs = 8 * C * ceil( (_nInfo+24) / (8*C) ) - 24;
+        }
+        else
+        {
+            if (_nInfo >= 8424)
+            {
+                C = ceil( (_nInfo+24) / 8424 );
+                tbs = 8 * C * ceil( (_nInfo+24) / (8*C) ) - 24;
+            }
+            else
+            {
+                tbs = 8 * ceil( (_nInfo+24) / 8 ) - 24;
+            }
+        }
+    }
+    return tbs;
+}
+
+struct McsElem
+{
+    unsigned int modFactor;
+    double coderate;    // R x 1024
+};
+
+static unsigned int refCodewordTbs(const McsElem& mcs, vector<unsigned char> layers, unsigned int numRe)
+{
+    double coderate = mcs.coderate / 1024;
+    double nInfo = numRe * coderate * mcs.modFactor * layers.at(0);
+    return refTbsFromNinfo(floor(nInfo), coderate);
+}
+
+// TS 38.214 Table 5.1.3.1-1 (64QAM) followed by Table 5.1.3.1-2 (256QAM), {Qm, R x 1024}
+static const McsElem MCS_TABLE[] = {
+    {2, 120}, {2, 157}, {2, 193}, {2, 251}, {2, 308}, {2, 379}, {2, 449}, {2, 526}, {2, 602}, {2, 679},
+    {4, 340}, {4, 378}, {4, 434}, {4, 490}, {4, 553}, {4, 616}, {4, 658},
+    {6, 438}, {6, 466}, {6, 517}, {6, 567}, {6, 616}, {6, 666}, {6, 719}, {6, 772}, {6, 822}, {6, 873}, {6, 910}, {6, 948},
+
+    {2, 120}, {2, 193}, {2, 308}, {2, 449}, {2, 602},
+    {4, 378}, {4, 434}, {4, 490}, {4, 553}, {4, 616}, {4, 658},
+    {6, 466}, {6, 517}, {6, 567}, {6, 616}, {6, 666}, {6, 719}, {6, 772}, {6, 822}, {6, 873},
+    {8, 682.5}, {8, 711}, {8, 754}, {8, 797}, {8, 841}, {8, 885}, {8, 916.5}, {8, 948}
+};
+static const unsigned int NUM_MCS = sizeof(MCS_TABLE) / sizeof(MCS_TABLE[0]);
+static const unsigned int MAX_LAYERS = 8;
+static const unsigned int MAX_SYMBOLS = 14;
+static const unsigned int MAX_BLOCKS = 275;
+
+static unsigned int benchKey(unsigned int mcs, unsigned int layers, unsigned int symbols)
+{
+    return (mcs * (MAX_LAYERS + 1) + layers) * (MAX_SYMBOLS + 1) + symbols;
+}
+
+// run one path over the full key range, returns the sum of the TBS (so that the work is not optimized out)
+template <typename Path>
+static unsigned long long runPass(Path path)
+{
+    unsigned long long sum = 0;
+    for (unsigned int m = 0; m < NUM_MCS; ++m)
+        for (unsigned int l = 1; l <= MAX_LAYERS; ++l)
+            for (unsigned int s = 1; s <= MAX_SYMBOLS; ++s)
+                for (unsigned int b = 1; b <= MAX_BLOCKS; ++b)
+                    sum += path(m, l, s, b);
+    return sum;
+}
+
+template <typename Path>
+static double timePath(const char* name, Path path, unsigned int passes, unsigned long long& checksum)
+{
+    auto start = chrono::steady_clock::now();
+    checksum = 0;
+    for (unsigned int p = 0; p < passes; ++p)
+        checksum += runPass(path);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    double calls = (double)passes * NUM_MCS * MAX_LAYERS * MAX_SYMBOLS * MAX_BLOCKS;
+    printf("%-28s %8.2f ns/call  (checksum %llu)\n", name, seconds * 1e9 / calls, checksum);
+    return seconds;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int passes = (argc > 1) ? atoi(argv[1]) : 5;
+    if (passes == 0)
+        passes = 1;
+
+    MecTbsCache cache;
+
+    auto reference = [](unsigned int m, unsigned int l, unsigned int s, unsigned int b) {
+        vector<unsigned char> layers(1, (unsigned char)l);
+        return refCodewordTbs(MCS_TABLE[m], layers, mecResourceElements(b, s));
+    };
+    auto direct = [](unsigned int m, unsigned int l, unsigned int s, unsigned int b) {
+        return mecCodewordTbs(MCS_TABLE[m].modFactor, MCS_TABLE[m].coderate / 1024, l, mecResourceElements(b, s));
+    };
+    auto memoized = [&cache, &direct](unsigned int m, unsigned int l, unsigned int s, unsigned int b) {
+        return cache.get(benchKey(m, l, s), b, [&]() { return direct(m, l, s, b); });
+    };
+
+    // the N_info -> TBS step alone, every integer N_info on both sides of the compile-time table
+    unsigned long long nInfoMismatch = 0;
+    for (unsigned int nInfo = 0; nInfo <= 4 * MEC_SMALL_NINFO_MAX; ++nInfo)
+        for (double coderate : {0.1, 0.25, 0.5, 0.9})
+            if (mecTbsFromNinfo(nInfo, coderate) != refTbsFromNinfo(nInfo, coderate) && nInfoMismatch++ < 10)
+                printf("N_info mismatch: N_info %u coderate %.2f: %u != %u\n", nInfo, coderate,
+                       mecTbsFromNinfo(nInfo, coderate), refTbsFromNinfo(nInfo, coderate));
+    printf("checked N_info 0..%u: %llu mismatches\n", 4 * MEC_SMALL_NINFO_MAX, nInfoMismatch);
+
+    // correctness over the full key range, the first memoized pass fills the cache
+    unsigned long long keys = 0, directMismatch = 0, memoMismatch = 0;
+    for (unsigned int m = 0; m < NUM_MCS; ++m)
+        for (unsigned int l = 1; l <= MAX_LAYERS; ++l)
+            for (unsigned int s = 1; s <= MAX_SYMBOLS; ++s)
+                for (unsigned int b = 1; b <= MAX_BLOCKS; ++b)
+                {
+                    unsigned int ref = reference(m, l, s, b);
+                    unsigned int d = direct(m, l, s, b);
+                    unsigned int c = memoized(m, l, s, b);
+                    if (d != ref && directMismatch++ < 10)
+                        printf("direct mismatch: mcs %u layers %u symbols %u blocks %u: %u != %u\n", m, l, s, b, d, ref);
+                    if (c != ref && memoMismatch++ < 10)
+                        printf("memoized mismatch: mcs %u layers %u symbols %u blocks %u: %u != %u\n", m, l, s, b, c, ref);
+                    ++keys;
+                }
+    printf("checked %llu keys: %llu direct mismatches, %llu memoized mismatches\n", keys, directMismatch, memoMismatch);
+
+    unsigned long long refSum, directSum, memoSum;
+    double refTime = timePath("reference (simu5g)", reference, passes, refSum);
+    double directTime = timePath("direct (constexpr table)", direct, passes, directSum);
+    double memoTime = timePath("memoized (MecTbsCache)", memoized, passes, memoSum);
+    printf("speedup over reference: direct %.1fx, memoized %.1fx\n", refTime / directTime, refTime / memoTime);
+
+    bool ok = nInfoMismatch == 0 && directMismatch == 0 && memoMismatch == 0 && refSum == directSum && refSum == memoSum;
+    return ok ? 0 : 1;
+}